@@ -0,0 +1,104 @@
+/*-----------------------------------------------------------------------------
+ *  ChunkedEncoding.hpp - A wrapper to split a list into independent chunks
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __CHUNKEDENCODING_HPP__
+#define __CHUNKEDENCODING_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+#include <compress/EncodingBase.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+/* A default # of integers in a chunk */
+const uint32_t CHUNKED_DEFAULT_LEN = 65536;
+
+/*
+ * Decoders overrun the tail of a chunk as DECODE_REQUIRE_MEM()
+ * allows, so a chunk must be longer than the overrun not to break
+ * any chunk but the next one.
+ */
+const uint32_t CHUNKED_MIN_LEN = DECODE_REQUIRE_MEM(0);
+
+/*
+ * ChunkedEncoding encodes every chunk of a list with a given
+ * codec independently, and writes a directory of chunk offsets
+ * in front of them. The format is as follows:
+ *
+ *    [chunk len][# of chunks][offsets (# of chunks + 1)][chunks]
+ *
+ * Offsets are counted from the head of the first chunk, so
+ * chunks can be decoded in parallel without any scan.
+ */
+class ChunkedEncoding : public EncodingBase {
+ public:
+  explicit ChunkedEncoding(EncodingPtr codec,
+                           uint32_t chunk = CHUNKED_DEFAULT_LEN);
+  ~ChunkedEncoding() throw();
+
+  void encodeArray(const uint32_t *in,
+                   uint64_t len,
+                   uint32_t *out,
+                   uint64_t *nvalue) const;
+
+  void decodeArray(const uint32_t *in,
+                   uint64_t len,
+                   uint32_t *out,
+                   uint64_t nvalue) const;
+
+  /*
+   * decodeParallel
+   *   Decode chunks concurrently into their positions in [out]
+   *     nthreads : # of threads, and 0 means the OpenMP default
+   */
+  void decodeParallel(const uint32_t *in,
+                      uint64_t len,
+                      uint32_t *out,
+                      uint64_t nvalue,
+                      int nthreads = 0) const;
+
+  /*
+   * decodeSortedParallel
+   *   Decode a list of d-gaps as decodeParallel() does, and restore
+   *   it as out[i] = (prev += out[i] + 1) by a two-pass parallel
+   *   prefix sum.
+   */
+  void decodeSortedParallel(const uint32_t *in,
+                            uint64_t len,
+                            uint32_t *out,
+                            uint64_t nvalue,
+                            uint32_t prev,
+                            int nthreads = 0) const;
+
+  uint64_t require(uint64_t len) const;
+
+ private:
+  void decodeChunks(const uint32_t *in,
+                    uint64_t len,
+                    uint32_t *out,
+                    uint64_t nvalue,
+                    int nthreads,
+                    std::vector<uint32_t> *sums) const;
+
+  EncodingPtr codec_;
+  uint32_t    chunk_;
+}; /* ChunkedEncoding */
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __CHUNKEDENCODING_HPP__ */
@@ -63,6 +63,31 @@ class EncodingBase {
                            uint32_t *out,
                            uint64_t nvalue) const = 0;
 
+  /*
+   * appendArray
+   *    in      : compressed 32-bit values generated by encodeArray
+   *    len     : 64-bit length for [in]
+   *    num     : # of integers that are encoded in [in]
+   *    add     : integer arrays to append
+   *    addlen  : 64-bit length for [add]
+   *    out     : given memory space as encodeArray, and the size is
+   *              decided by require(num + addlen)
+   *    nvalue  : equals to require(num + addlen), and write back the
+   *              actual written number of 32-bit values in [out]
+   *
+   *    The output is the same with encodeArray for both arrays. By
+   *    default, it decodes all and encodes them again, and codecs of
+   *    blocks copy full blocks as they are and re-encode only the
+   *    trailing partial block with [add].
+   */
+  virtual void appendArray(const uint32_t *in,
+                           uint64_t len,
+                           uint64_t num,
+                           const uint32_t *add,
+                           uint64_t addlen,
+                           uint32_t *out,
+                           uint64_t *nvalue) const;
+
  private:
   int policy_;
 };
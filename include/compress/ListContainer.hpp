@@ -0,0 +1,416 @@
+/*-----------------------------------------------------------------------------
+ *  ListContainer.hpp - A self-describing file of compressed lists
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __LISTCONTAINER_HPP__
+#define __LISTCONTAINER_HPP__
+
+#include <misc/encoding_internals.hpp>
+#include <misc/encoding_aio.hpp>
+
+#include <compress/EncodingBase.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+class ListContainerReader;
+
+/* "VCF2" in a file, and the version of the format */
+const uint32_t LIST_CONTAINER_MAGIC = 0x32464356;
+const uint32_t LIST_CONTAINER_VERSION = 2;
+
+/* Sizes in bytes */
+const uint64_t LIST_CONTAINER_HEADER_SZ = 32;
+const uint64_t LIST_CONTAINER_ENTRY_SZ = 24;
+const uint64_t LIST_CONTAINER_FOOTER_SZ = 32;
+
+/*
+ * Alignments of payloads in bytes. LIST_CONTAINER_ALIGN_WORD is
+ * the default, and the others are for SIMD loads, cache lines
+ * and pages.
+ */
+const uint32_t LIST_CONTAINER_ALIGN_WORD = 4;
+const uint32_t LIST_CONTAINER_ALIGN_SIMD = 16;
+const uint32_t LIST_CONTAINER_ALIGN_LINE = 64;
+const uint32_t LIST_CONTAINER_ALIGN_PAGE = 4096;
+
+/*
+ * A list in a directory
+ *    offset : the head of a payload in 32-bit words from the
+ *             head of a file
+ *    len    : the length of a payload in 32-bit words
+ *    num    : # of integers that [codec] encodes in the payload
+ *    base   : a value given by a writer, e.g., the first docid
+ *    crc    : CRC-32C of the payload
+ */
+struct ListEntry {
+  uint64_t  offset;
+  uint32_t  len;
+  uint32_t  num;
+  uint32_t  base;
+  uint32_t  crc;
+  int       codec;
+};
+
+/*
+ * ListContainer is a single file of lists, each of which has
+ * its own codec. The format is as follows:
+ *
+ *    [header][payloads][directory][footer]
+ *
+ *    header    : magic, version, alignment, 0, # of lists and
+ *                the byte offset of the directory (64-bit)
+ *    directory : an entry of 24 bytes for each list, that is,
+ *                (offset << 8 | codec) in 64-bit, len, num,
+ *                base and crc
+ *    footer    : CRC-32C of the directory and the header, # of
+ *                lists, the file length, magic and version
+ *
+ * All values are byte-order free, and every payload starts
+ * at a 32-bit boundary. A reader locates any list in O(1) with
+ * the fixed-size entries.
+ *
+ * With a larger alignment, a payload of the alignment or more
+ * starts at its boundary. Smaller ones go first-fit into gaps
+ * that the padding leaves, and never cross a boundary, so the
+ * space overhead is less than the alignment per large list.
+ */
+class ListContainerWriter {
+ public:
+  explicit ListContainerWriter(
+      const std::string& filename,
+      uint32_t align = LIST_CONTAINER_ALIGN_WORD);
+
+  /*
+   * Start a new generation of [base] in another file. Payloads of
+   * [base] are copied as they are, so its lists keep their offsets,
+   * and new payloads go after them.
+   */
+  ListContainerWriter(const std::string& filename,
+                      const ListContainerReader& base);
+
+  ~ListContainerWriter() throw();
+
+  /*
+   * append
+   *   Append a payload of [len] words that [codec] encodes
+   *   [num] integers into, and return the index of the list
+   */
+  uint64_t append(int codec, uint32_t num, uint32_t base,
+                  const uint32_t *data, uint64_t len);
+
+  /*
+   * update
+   *   Replace the i-th list with a new payload, which goes after
+   *   the others. The old payload is left as garbage.
+   */
+  void update(uint64_t i, int codec, uint32_t num, uint32_t base,
+              const uint32_t *data, uint64_t len);
+
+  /* Write down the directory, footer and header */
+  void close();
+
+  uint64_t size() const {
+    return entries_.size();
+  }
+
+ private:
+  void write(const void *buf, uint64_t n);
+  void writeAt(uint64_t off, const void *buf, uint64_t n);
+  void pad(uint64_t n);
+  uint64_t place(uint64_t n);
+  ListEntry put(int codec, uint32_t num, uint32_t base,
+                const uint32_t *data, uint64_t len);
+
+  FILE                          *fp_;
+  uint64_t                      pos_;
+  uint32_t                      align_;
+  std::vector<ListEntry>        entries_;
+  std::map<uint64_t, uint64_t>  gaps_;
+
+  DISALLOW_COPY_AND_ASSIGN(ListContainerWriter);
+}; /* ListContainerWriter */
+
+class ListContainerReader {
+ public:
+  /* Map a file in read-only */
+  explicit ListContainerReader(const std::string& filename);
+
+  /* Read a container in memory, which a caller keeps alive */
+  ListContainerReader(const uint32_t *addr, uint64_t size);
+
+  ~ListContainerReader() throw();
+
+  /* Whether a file image starts with the header of this format */
+  static bool Probe(const uint32_t *addr, uint64_t size);
+
+  uint64_t size() const {
+    return nlists_;
+  }
+
+  uint32_t alignment() const {
+    return align_;
+  }
+
+  ListEntry entry(uint64_t i) const;
+
+  const uint32_t *payload(const ListEntry& e) const {
+    return addr_ + e.offset;
+  }
+
+  /*
+   * prefetch
+   *   Prefetch the head of the i-th list into caches, which is
+   *   cheap enough to call for each list. It ignores i out of range.
+   */
+  void prefetch(uint64_t i) const;
+
+  /*
+   * advise
+   *   Ask the kernel to read pages of [n] lists from the i-th one
+   *   if a file is mapped. It costs a system call, so callers should
+   *   advise a run of lists at once.
+   */
+  void advise(uint64_t i, uint64_t n) const;
+
+  /* Check CRC-32C of the directory, or of a list */
+  bool verifyDirectory() const;
+  bool verify(uint64_t i) const;
+
+  /*
+   * verifyAll
+   *   Check the directory and all lists, and return # of broken
+   *   lists. The directory counts as one.
+   *     nthreads : # of threads, and 0 means the OpenMP default
+   */
+  uint64_t verifyAll(int nthreads = 0) const;
+
+  /*
+   * decode
+   *   Decode the i-th list into [out], which needs the room of
+   *   DECODE_REQUIRE_MEM(num). The payload is checked before
+   *   decoding if [verified] is true, so hot paths skip it.
+   */
+  void decode(uint64_t i, uint32_t *out, bool verified = false) const;
+
+ private:
+  void parse();
+
+  /* A writer copies payloads for a new generation */
+  friend class ListContainerWriter;
+
+  const uint32_t  *addr_;
+  uint64_t        size_;
+  bool            mapped_;
+  uint64_t        nlists_;
+  uint64_t        diroff_;
+  uint32_t        align_;
+  EncodingPtr     codecs_[NUMCODERS];
+
+  DISALLOW_COPY_AND_ASSIGN(ListContainerReader);
+}; /* ListContainerReader */
+
+/*
+ * ListFetcher reads lists of a container with io_uring or pread
+ * instead of mmap, so that lists on a disk are read by batches
+ * rather than by page faults one by one. Only the directory is
+ * kept in memory, and it is checked when a file is opened.
+ */
+class ListFetcher {
+ public:
+  typedef std::function<void(uint64_t k,
+                             const ListEntry& e,
+                             const uint32_t *list)> callback_t;
+
+  /*
+   * Open a file, where
+   *   depth    : # of reads in flight
+   *   nthreads : # of threads to pread lists without io_uring, and
+   *              0 means the OpenMP default
+   */
+  explicit ListFetcher(const std::string& filename,
+                       uint32_t depth = 64, int nthreads = 0);
+  ~ListFetcher() throw();
+
+  uint64_t size() const {
+    return nlists_;
+  }
+
+  uint32_t alignment() const {
+    return align_;
+  }
+
+  /* Whether reads go through io_uring */
+  bool async() const {
+    return aio_->async();
+  }
+
+  ListEntry entry(uint64_t i) const;
+
+  /*
+   * fetch
+   *   Read the lists of [n] indices in [ids], and call fn(k, e,
+   *   list) as soon as the list of ids[k] is decoded. Calls come
+   *   in any order, and may come from several threads at once
+   *   without io_uring. [list] is valid only in a call, and the
+   *   payload is checked before decoding if [verified] is true.
+   */
+  void fetch(const uint64_t *ids, uint64_t n,
+             const callback_t& fn, bool verified = false);
+
+ private:
+  int                         fd_;
+  uint64_t                    size_;
+  uint64_t                    nlists_;
+  uint64_t                    diroff_;
+  uint32_t                    align_;
+  std::vector<char>           dir_;
+  std::unique_ptr<AioReader>  aio_;
+  EncodingPtr                 codecs_[NUMCODERS];
+
+  DISALLOW_COPY_AND_ASSIGN(ListFetcher);
+}; /* ListFetcher */
+
+/*
+ * ListContainerAppender appends integers to lists of a container,
+ * and writes a new generation of it in another file, so that the
+ * old one is left as it is. Lists without new integers are copied
+ * byte for byte, and the others move to the tail, where codecs of
+ * blocks re-encode only the trailing partial block with new ones
+ * (See EncodingBase::appendArray()). Integers are given to codecs
+ * as they are, so callers make d-gaps from the last docid.
+ */
+class ListContainerAppender {
+ public:
+  ListContainerAppender(const std::string& src, const std::string& dst);
+  ~ListContainerAppender() throw();
+
+  /* The old generation */
+  const ListContainerReader& base() const {
+    return *reader_;
+  }
+
+  /* # of lists in the new generation */
+  uint64_t size() const {
+    return writer_->size();
+  }
+
+  /*
+   * append
+   *   Append [n] integers to the i-th list of the old generation.
+   *   They are kept in memory until close(), so a list may take
+   *   several calls.
+   */
+  void append(uint64_t i, const uint32_t *data, uint64_t n);
+
+  /* Add a list that [codec] encodes, and return the index */
+  uint64_t add(int codec, uint32_t base, const uint32_t *data, uint64_t n);
+
+  /*
+   * close
+   *   Write appended lists, and return # of them. Old payloads are
+   *   checked with CRC-32C before they are copied into new ones.
+   */
+  uint64_t close();
+
+ private:
+  std::unique_ptr<ListContainerReader>        reader_;
+  std::unique_ptr<ListContainerWriter>        writer_;
+  std::map<uint64_t, std::vector<uint32_t> >  pending_;
+  EncodingPtr                                 codecs_[NUMCODERS];
+
+  DISALLOW_COPY_AND_ASSIGN(ListContainerAppender);
+}; /* ListContainerAppender */
+
+/*
+ * Options of ListContainerMerger
+ *    codec    : a codec of lists that are encoded again, and -1
+ *               keeps the one of the segment with the first docid
+ *    align    : an alignment of the merged file, and 0 takes the
+ *               one of the first segment
+ *    budget   : # of integers that a batch of lists holds at most,
+ *               which bounds memory with a list longer than it
+ *               as an exception
+ *    nthreads : # of threads, and 0 means the OpenMP default
+ *    verify   : check CRC-32C of lists before reading them
+ */
+struct ListMergeConfig {
+  int       codec;
+  uint32_t  align;
+  uint64_t  budget;
+  int       nthreads;
+  bool      verify;
+
+  ListMergeConfig()
+      : codec(-1), align(0), budget(1ULL << 24),
+        nthreads(0), verify(false) {}
+};
+
+/*
+ * # of merged lists by the ways they are built
+ *    copied  : lists in a single segment, whose payloads are copied
+ *    spliced : lists whose segments have disjoint docid ranges. The
+ *              rest go after the first range by appendArray(), so
+ *              codecs of blocks keep its full blocks as they are.
+ *    merged  : lists whose segments interleave or that take another
+ *              codec, which are decoded, merged and encoded again
+ */
+struct ListMergeStats {
+  uint64_t  nums;
+  uint64_t  copied;
+  uint64_t  spliced;
+  uint64_t  merged;
+
+  ListMergeStats() : nums(0), copied(0), spliced(0), merged(0) {}
+};
+
+/*
+ * ListContainerMerger merges segments of an index, which are
+ * containers whose i-th lists are of the same term, into a single
+ * container. Lists are streamed by batches under the budget, and
+ * those in a batch are built in parallel and written in order.
+ * A docid found in several segments is written once.
+ */
+class ListContainerMerger {
+ public:
+  explicit ListContainerMerger(const std::vector<std::string>& srcs,
+                               const ListMergeConfig& conf =
+                                   ListMergeConfig());
+  ~ListContainerMerger() throw();
+
+  /* # of lists in the merged container */
+  uint64_t size() const {
+    return nlists_;
+  }
+
+  void merge(const std::string& dst, ListMergeStats *stats = NULL) const;
+
+ private:
+  struct Merged;
+
+  void mergeList(uint64_t i, const EncodingPtr *codecs,
+                 Merged *m) const;
+
+  std::vector<std::unique_ptr<ListContainerReader> >  readers_;
+  ListMergeConfig                                     conf_;
+  uint64_t                                            nlists_;
+
+  DISALLOW_COPY_AND_ASSIGN(ListContainerMerger);
+}; /* ListContainerMerger */
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __LISTCONTAINER_HPP__ */
@@ -17,12 +17,43 @@
 #include <misc/encoding_internals.hpp>
 #include <compress/policy/AFOR/Compressor.hpp>
 #include <compress/policy/AFOR/VarByte.hpp>
-#include <compress/policy/AFOR/AFOR_pack.hpp>
-#include <compress/policy/AFOR/AFOR_unpack.hpp>
+#include <misc/encoding_bitpack.hpp>
+#include <misc/encoding_threaded.hpp>
 
 namespace integer_encoding {
 namespace internals {
 
+/*
+ * Frames that ThreadedDecoder decodes. A header has a frame length
+ * of 8, 16 or 32 in the upper bits and a bit width - 1 in lower 5 bits.
+ */
+template<typename T>
+struct AFORFrameOps {
+	T *des;
+	const char *src;
+	T *dterm;
+
+	bool more() const {
+		return dterm - des >= 8;
+	}
+
+	uint32_t next() {
+		return *(const uint8_t*) src++;
+	}
+
+	template<uint32_t H>
+	FORCE_INLINE void decode() {
+		const uint32_t frameLength = 8 << (H >> 5);
+		const uint32_t bitWidth = (H & 31) + 1;
+
+		BitUnpack<BITPACK_LSB, bitWidth, frameLength, T>(des,
+				(const uint32_t*) src);
+		src += (bitWidth * frameLength) >> 3;
+		des += frameLength;
+		ENCODING_STAT(STAT_AFOR_FRAMELEN, frameLength);
+	}
+};
+
 class AFOR: public Compressor, public EncodingBase {
 public:
 
@@ -59,6 +90,12 @@ public:
 	void decodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
 			uint64_t nvalue) const;
 
+	// [len] and [nvalue] are in bytes as encodeArray writes back,
+	// and frames of full windows are copied as they are
+	void appendArray(const uint32_t *in, uint64_t len, uint64_t num,
+			const uint32_t *add, uint64_t addlen, uint32_t *out,
+			uint64_t *nvalue) const;
+
 	uint64_t require(uint64_t len) const;
 	/***************************************************************************/
 	virtual int
@@ -89,10 +126,6 @@ private:
 	template<typename T>
 	int encodeBlock(char* des, const T* src);
 
-	template<typename T>
-	void decodeFrame(T* des, const char* src, int &frameLength,
-			int &frameByte) const;
-
 	template<typename T>
 	int chooseBestConfig(const T *src, AFORConfig configArr[]) const;
 
@@ -104,6 +137,15 @@ private:
 	int encodeWindUp(char *des, const T *src, uint32_t encodeNum) const;
 
 protected:
+	// # of integers in a window, whose frames are independent
+	virtual uint32_t windowLength() const {
+		return m_windowSize;
+	}
+
+	template<typename T>
+	static int encodeFrame(char *des, const T *src, uint32_t frameLengthId,
+			uint32_t bitWidth);
+
 	static const uint32_t m_windowSize = 32;
 };
 
@@ -184,100 +226,14 @@ int AFOR::encode(char* des, const T* src, uint32_t encodeNum) const {
 
 template<typename T>
 int AFOR::decode(T* des, const char* src, uint32_t decodeNum) const {
-	uint32_t byteDecompressed = 0;
-	uint32_t decoded = 0;
-
-	FILE* stat = fopen("./share/aforstatistic", "a");
-
-	while (decoded < decodeNum) {
-		/*if (decoded + m_windowSize <= decodeNum) {
-		 uint32_t rightWindow = decoded + 32;
-		 int frameByte, frameLength;
-		 while (decoded < rightWindow) {
-		 decodeFrame(des + decoded, src + byteDecompressed, frameLength, frameByte);
-		 byteDecompressed += frameByte;
-		 decoded += frameLength;
-		 }*/
-		if (decoded + 8 <= decodeNum) {
-			int frameByte, frameLength;
-			decodeFrame(des + decoded, src + byteDecompressed, frameLength,
-					frameByte);
-			byteDecompressed += frameByte;
-			decoded += frameLength;
-			fwrite(&frameLength, 4, 1, stat);
-		} else {
-			byteDecompressed += (uint32_t) VarByte::decode<T>(des + decoded,
-					src + byteDecompressed, decodeNum - decoded);
-			decoded = decodeNum;
-		}
-	}
-	fflush(stat);
-	fclose(stat);
-	return (int) byteDecompressed;
-}
+	AFORFrameOps<T> ops = { des, src, des + decodeNum };
+	ThreadedDecoder<AFORFrameOps<T>, 96>::run(&ops);
 
-template<typename T>
-void AFOR::decodeFrame(T* des, const char* src, int &frameLength,
-		int &frameByte) const {
-	typedef void (*AFORunpackFun)(T *des, const uint32_t *srcInt);
-	static AFORunpackFun unpackFuns[96] = { AFOR_unpack_8_1<T>, AFOR_unpack_8_2<
-			T>, AFOR_unpack_8_3<T>, AFOR_unpack_8_4<T>, AFOR_unpack_8_5<T>,
-			AFOR_unpack_8_6<T>, AFOR_unpack_8_7<T>, AFOR_unpack_8_8<T>,
-			AFOR_unpack_8_9<T>, AFOR_unpack_8_10<T>, AFOR_unpack_8_11<T>,
-			AFOR_unpack_8_12<T>, AFOR_unpack_8_13<T>, AFOR_unpack_8_14<T>,
-			AFOR_unpack_8_15<T>, AFOR_unpack_8_16<T>, AFOR_unpack_8_17<T>,
-			AFOR_unpack_8_18<T>, AFOR_unpack_8_19<T>, AFOR_unpack_8_20<T>,
-			AFOR_unpack_8_21<T>, AFOR_unpack_8_22<T>, AFOR_unpack_8_23<T>,
-			AFOR_unpack_8_24<T>, AFOR_unpack_8_25<T>, AFOR_unpack_8_26<T>,
-			AFOR_unpack_8_27<T>, AFOR_unpack_8_28<T>, AFOR_unpack_8_29<T>,
-			AFOR_unpack_8_30<T>, AFOR_unpack_8_31<T>, AFOR_unpack_8_32<T>,
-			AFOR_unpack_16_1<T>, AFOR_unpack_16_2<T>, AFOR_unpack_16_3<T>,
-			AFOR_unpack_16_4<T>, AFOR_unpack_16_5<T>, AFOR_unpack_16_6<T>,
-			AFOR_unpack_16_7<T>, AFOR_unpack_16_8<T>, AFOR_unpack_16_9<T>,
-			AFOR_unpack_16_10<T>, AFOR_unpack_16_11<T>, AFOR_unpack_16_12<T>,
-			AFOR_unpack_16_13<T>, AFOR_unpack_16_14<T>, AFOR_unpack_16_15<T>,
-			AFOR_unpack_16_16<T>, AFOR_unpack_16_17<T>, AFOR_unpack_16_18<T>,
-			AFOR_unpack_16_19<T>, AFOR_unpack_16_20<T>, AFOR_unpack_16_21<T>,
-			AFOR_unpack_16_22<T>, AFOR_unpack_16_23<T>, AFOR_unpack_16_24<T>,
-			AFOR_unpack_16_25<T>, AFOR_unpack_16_26<T>, AFOR_unpack_16_27<T>,
-			AFOR_unpack_16_28<T>, AFOR_unpack_16_29<T>, AFOR_unpack_16_30<T>,
-			AFOR_unpack_16_31<T>, AFOR_unpack_16_32<T>, AFOR_unpack_32_1<T>,
-			AFOR_unpack_32_2<T>, AFOR_unpack_32_3<T>, AFOR_unpack_32_4<T>,
-			AFOR_unpack_32_5<T>, AFOR_unpack_32_6<T>, AFOR_unpack_32_7<T>,
-			AFOR_unpack_32_8<T>, AFOR_unpack_32_9<T>, AFOR_unpack_32_10<T>,
-			AFOR_unpack_32_11<T>, AFOR_unpack_32_12<T>, AFOR_unpack_32_13<T>,
-			AFOR_unpack_32_14<T>, AFOR_unpack_32_15<T>, AFOR_unpack_32_16<T>,
-			AFOR_unpack_32_17<T>, AFOR_unpack_32_18<T>, AFOR_unpack_32_19<T>,
-			AFOR_unpack_32_20<T>, AFOR_unpack_32_21<T>, AFOR_unpack_32_22<T>,
-			AFOR_unpack_32_23<T>, AFOR_unpack_32_24<T>, AFOR_unpack_32_25<T>,
-			AFOR_unpack_32_26<T>, AFOR_unpack_32_27<T>, AFOR_unpack_32_28<T>,
-			AFOR_unpack_32_29<T>, AFOR_unpack_32_30<T>, AFOR_unpack_32_31<T>,
-			AFOR_unpack_32_32<T> , };
-
-	static uint32_t FrameByteArr[96] =
-			{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
-					20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 2, 4, 6,
-					8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36,
-					38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 4,
-					8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64,
-					68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116,
-					120, 124, 128, };
-
-	static uint32_t FrameLenArr[3] = { 8, 16, 32 };
+	// 剩余不足8个integer
+	if (ops.des < ops.dterm)
+		ops.src += VarByte::decode<T>(ops.des, ops.src, ops.dterm - ops.des);
 
-	/*
-	 * step1: read 1 byte frame header: lower 5 bits for bitwidth, mid 2 bits from frame length
-	 */
-	uint8_t frameHeader = *(uint8_t*) src;
-	src++;
-
-	/*
-	 * step2: given bitwidth and frame length, decode a frame of integers
-	 */
-	(unpackFuns[frameHeader])(des, (const uint32_t*) src);
-
-	frameByte = 1 + FrameByteArr[frameHeader]; // do not forget the header byte!
-	frameLength = FrameLenArr[frameHeader >> 5];
+	return (int) (ops.src - src);
 }
 
 /*
@@ -315,11 +271,7 @@ int AFOR::chooseBestConfig(const T *src, AFOR::AFORConfig configArr[]) const {
 		}
 
 		// get effective bit length
-		uint32_t ebl = 0;
-		while (tmp > 0) {
-			ebl++;
-			tmp >>= 1;
-		}
+		uint32_t ebl = 32 - MSB32(static_cast<uint32_t>(tmp));
 		if (ebl == 0) {	//encode 0
 			ebl = 1;
 		}
@@ -372,64 +324,44 @@ int AFOR::chooseBestConfig(const T *src, AFOR::AFORConfig configArr[]) const {
 	return bestConf;
 }
 
+/*
+ * Write a header byte and a frame of integers packed in bitWidth bits,
+ * and return the bytes written. frameLengthId is 0, 32 or 64 for
+ * frames of 8, 16 or 32 integers.
+ */
+template<typename T>
+int AFOR::encodeFrame(char *des, const T *src, uint32_t frameLengthId,
+		uint32_t bitWidth) {
+	uint8_t frameHeader = frameLengthId + bitWidth - 1;	// bitwidth -> 0 to 31
+	*des++ = frameHeader;
+
+	uint32_t frameLength = 8 << (frameLengthId >> 5);
+	switch (frameLength) {
+	case 8:
+		BitPackKernels<BITPACK_LSB, 8, T>::pack[bitWidth]((uint32_t*) des, src);
+		break;
+	case 16:
+		BitPackKernels<BITPACK_LSB, 16, T>::pack[bitWidth]((uint32_t*) des, src);
+		break;
+	default:
+		BitPackKernels<BITPACK_LSB, 32, T>::pack[bitWidth]((uint32_t*) des, src);
+		break;
+	}
+
+	return 1 + ((bitWidth * frameLength) >> 3);
+}
+
 template<typename T>
 int AFOR::encodeConfig(char *des, const T *src, int configId,
 		AFOR::AFORConfig configArr[]) const {
 
 #define MAX_OF_TWO(x, y) ((x) > (y) ? (x) : (y))
 
-	typedef void (*AFORpackFun)(uint32_t *des, const T *srcInt);
-	static AFORpackFun packFuns[96] = { AFOR_pack_8_1<T>, AFOR_pack_8_2<T>,
-			AFOR_pack_8_3<T>, AFOR_pack_8_4<T>, AFOR_pack_8_5<T>, AFOR_pack_8_6<
-					T>, AFOR_pack_8_7<T>, AFOR_pack_8_8<T>, AFOR_pack_8_9<T>,
-			AFOR_pack_8_10<T>, AFOR_pack_8_11<T>, AFOR_pack_8_12<T>,
-			AFOR_pack_8_13<T>, AFOR_pack_8_14<T>, AFOR_pack_8_15<T>,
-			AFOR_pack_8_16<T>, AFOR_pack_8_17<T>, AFOR_pack_8_18<T>,
-			AFOR_pack_8_19<T>, AFOR_pack_8_20<T>, AFOR_pack_8_21<T>,
-			AFOR_pack_8_22<T>, AFOR_pack_8_23<T>, AFOR_pack_8_24<T>,
-			AFOR_pack_8_25<T>, AFOR_pack_8_26<T>, AFOR_pack_8_27<T>,
-			AFOR_pack_8_28<T>, AFOR_pack_8_29<T>, AFOR_pack_8_30<T>,
-			AFOR_pack_8_31<T>, AFOR_pack_8_32<T>, AFOR_pack_16_1<T>,
-			AFOR_pack_16_2<T>, AFOR_pack_16_3<T>, AFOR_pack_16_4<T>,
-			AFOR_pack_16_5<T>, AFOR_pack_16_6<T>, AFOR_pack_16_7<T>,
-			AFOR_pack_16_8<T>, AFOR_pack_16_9<T>, AFOR_pack_16_10<T>,
-			AFOR_pack_16_11<T>, AFOR_pack_16_12<T>, AFOR_pack_16_13<T>,
-			AFOR_pack_16_14<T>, AFOR_pack_16_15<T>, AFOR_pack_16_16<T>,
-			AFOR_pack_16_17<T>, AFOR_pack_16_18<T>, AFOR_pack_16_19<T>,
-			AFOR_pack_16_20<T>, AFOR_pack_16_21<T>, AFOR_pack_16_22<T>,
-			AFOR_pack_16_23<T>, AFOR_pack_16_24<T>, AFOR_pack_16_25<T>,
-			AFOR_pack_16_26<T>, AFOR_pack_16_27<T>, AFOR_pack_16_28<T>,
-			AFOR_pack_16_29<T>, AFOR_pack_16_30<T>, AFOR_pack_16_31<T>,
-			AFOR_pack_16_32<T>, AFOR_pack_32_1<T>, AFOR_pack_32_2<T>,
-			AFOR_pack_32_3<T>, AFOR_pack_32_4<T>, AFOR_pack_32_5<T>,
-			AFOR_pack_32_6<T>, AFOR_pack_32_7<T>, AFOR_pack_32_8<T>,
-			AFOR_pack_32_9<T>, AFOR_pack_32_10<T>, AFOR_pack_32_11<T>,
-			AFOR_pack_32_12<T>, AFOR_pack_32_13<T>, AFOR_pack_32_14<T>,
-			AFOR_pack_32_15<T>, AFOR_pack_32_16<T>, AFOR_pack_32_17<T>,
-			AFOR_pack_32_18<T>, AFOR_pack_32_19<T>, AFOR_pack_32_20<T>,
-			AFOR_pack_32_21<T>, AFOR_pack_32_22<T>, AFOR_pack_32_23<T>,
-			AFOR_pack_32_24<T>, AFOR_pack_32_25<T>, AFOR_pack_32_26<T>,
-			AFOR_pack_32_27<T>, AFOR_pack_32_28<T>, AFOR_pack_32_29<T>,
-			AFOR_pack_32_30<T>, AFOR_pack_32_31<T>, AFOR_pack_32_32<T> , };
-
-	static uint32_t FrameByteArr[96] =
-			{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
-					20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 2, 4, 6,
-					8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36,
-					38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 4,
-					8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64,
-					68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116,
-					120, 124, 128, };
-
 	const AFOR::AFORConfig &configChoosen = configArr[configId];
 	for (uint32_t i = 0; i < configChoosen.numFrames; ++i) {
-		uint8_t frameHeader = configChoosen.frames[i].frameLengthId
-				+ configChoosen.frames[i].bitWidth - 1;	// bitwidth -> 0 to 31
-		*des++ = frameHeader;
-		(packFuns[frameHeader])((uint32_t*) des, src);
+		des += encodeFrame(des, src, configChoosen.frames[i].frameLengthId,
+				configChoosen.frames[i].bitWidth);
 		src += configChoosen.frames[i].frameLength;
-		des += (configChoosen.frames[i].bitWidth
-				* configChoosen.frames[i].frameLength) >> 3;//devided by 8(bit->Byte)
 	}
 
 	return configChoosen.totalByte;
@@ -441,49 +373,6 @@ int AFOR::encodeConfig(char *des, const T *src, int configId,
  */
 template<typename T>
 int AFOR::encodeWindUp(char *des, const T *src, uint32_t encodeNum) const {
-	typedef void (*AFORpackFun)(uint32_t *des, const T *srcInt);
-	static AFORpackFun packFuns[96] = { AFOR_pack_8_1<T>, AFOR_pack_8_2<T>,
-			AFOR_pack_8_3<T>, AFOR_pack_8_4<T>, AFOR_pack_8_5<T>, AFOR_pack_8_6<
-					T>, AFOR_pack_8_7<T>, AFOR_pack_8_8<T>, AFOR_pack_8_9<T>,
-			AFOR_pack_8_10<T>, AFOR_pack_8_11<T>, AFOR_pack_8_12<T>,
-			AFOR_pack_8_13<T>, AFOR_pack_8_14<T>, AFOR_pack_8_15<T>,
-			AFOR_pack_8_16<T>, AFOR_pack_8_17<T>, AFOR_pack_8_18<T>,
-			AFOR_pack_8_19<T>, AFOR_pack_8_20<T>, AFOR_pack_8_21<T>,
-			AFOR_pack_8_22<T>, AFOR_pack_8_23<T>, AFOR_pack_8_24<T>,
-			AFOR_pack_8_25<T>, AFOR_pack_8_26<T>, AFOR_pack_8_27<T>,
-			AFOR_pack_8_28<T>, AFOR_pack_8_29<T>, AFOR_pack_8_30<T>,
-			AFOR_pack_8_31<T>, AFOR_pack_8_32<T>, AFOR_pack_16_1<T>,
-			AFOR_pack_16_2<T>, AFOR_pack_16_3<T>, AFOR_pack_16_4<T>,
-			AFOR_pack_16_5<T>, AFOR_pack_16_6<T>, AFOR_pack_16_7<T>,
-			AFOR_pack_16_8<T>, AFOR_pack_16_9<T>, AFOR_pack_16_10<T>,
-			AFOR_pack_16_11<T>, AFOR_pack_16_12<T>, AFOR_pack_16_13<T>,
-			AFOR_pack_16_14<T>, AFOR_pack_16_15<T>, AFOR_pack_16_16<T>,
-			AFOR_pack_16_17<T>, AFOR_pack_16_18<T>, AFOR_pack_16_19<T>,
-			AFOR_pack_16_20<T>, AFOR_pack_16_21<T>, AFOR_pack_16_22<T>,
-			AFOR_pack_16_23<T>, AFOR_pack_16_24<T>, AFOR_pack_16_25<T>,
-			AFOR_pack_16_26<T>, AFOR_pack_16_27<T>, AFOR_pack_16_28<T>,
-			AFOR_pack_16_29<T>, AFOR_pack_16_30<T>, AFOR_pack_16_31<T>,
-			AFOR_pack_16_32<T>, AFOR_pack_32_1<T>, AFOR_pack_32_2<T>,
-			AFOR_pack_32_3<T>, AFOR_pack_32_4<T>, AFOR_pack_32_5<T>,
-			AFOR_pack_32_6<T>, AFOR_pack_32_7<T>, AFOR_pack_32_8<T>,
-			AFOR_pack_32_9<T>, AFOR_pack_32_10<T>, AFOR_pack_32_11<T>,
-			AFOR_pack_32_12<T>, AFOR_pack_32_13<T>, AFOR_pack_32_14<T>,
-			AFOR_pack_32_15<T>, AFOR_pack_32_16<T>, AFOR_pack_32_17<T>,
-			AFOR_pack_32_18<T>, AFOR_pack_32_19<T>, AFOR_pack_32_20<T>,
-			AFOR_pack_32_21<T>, AFOR_pack_32_22<T>, AFOR_pack_32_23<T>,
-			AFOR_pack_32_24<T>, AFOR_pack_32_25<T>, AFOR_pack_32_26<T>,
-			AFOR_pack_32_27<T>, AFOR_pack_32_28<T>, AFOR_pack_32_29<T>,
-			AFOR_pack_32_30<T>, AFOR_pack_32_31<T>, AFOR_pack_32_32<T> , };
-
-	static uint32_t FrameByteArr[96] =
-			{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
-					20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 2, 4, 6,
-					8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36,
-					38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 4,
-					8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64,
-					68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116,
-					120, 124, 128, };
-
 	char *desBeg = des;
 	for (int i = 0; i < encodeNum; i += 8) {
 		// choose max of each 8 integers
@@ -493,20 +382,14 @@ int AFOR::encodeWindUp(char *des, const T *src, uint32_t encodeNum) const {
 		}
 
 		// get effective bit length
-		uint32_t ebl = 0;
-		while (tmp > 0) {
-			ebl++;
-			tmp >>= 1;
-		}
+		uint32_t ebl = 32 - MSB32(static_cast<uint32_t>(tmp));
 		if (ebl == 0) {	//encode 0
 			ebl = 1;
 		}
 
-		uint8_t frameHeader = ebl - 1;	// ebl不会超过31，进而限定只是用framelength=8
-		*des++ = frameHeader;
-		(packFuns[frameHeader])((uint32_t*) des, src);
+		// ebl不会超过31，进而限定只是用framelength=8
+		des += encodeFrame(des, src, 0, ebl);
 		src += 8;
-		des += ebl;
 	}
 	return des - desBeg;
 }
@@ -0,0 +1,176 @@
+/**
+ * filename:GAFOR.hpp
+ * @brief:Generalized AFOR, which takes windows of any multiple of 8 integers
+ *        and partitions each window into frames by dynamic programming.
+ *        Frames have the same headers as AFOR, so AFOR decodes them.
+ * @data:2026-10-18
+ */
+
+#ifndef GAFOR_HPP_
+#define GAFOR_HPP_
+#include <stdint.h>
+#include <algorithm>
+
+#include <compress/policy/AFOR/AFOR.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+/* A default # of integers in a window, and the max of it */
+const uint32_t GAFOR_WINDOWSZ = 256;
+const uint32_t GAFOR_MAX_WINDOWSZ = 4096;
+
+class GAFOR: public AFOR {
+public:
+	/*
+	 * windowSize must be a multiple of 8, and frames are
+	 * minFrame to maxFrame long in 8, 16 or 32.
+	 */
+	explicit GAFOR(uint32_t windowSize = GAFOR_WINDOWSZ,
+			uint32_t minFrame = 8, uint32_t maxFrame = 32);
+
+	~GAFOR() throw ();
+
+	// decodeArray is inherited from AFOR
+	void encodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
+			uint64_t *nvalue) const;
+
+	virtual int
+	encodeUint32(char* des, const uint32_t* src, uint32_t encodeNum);
+	virtual int
+	encodeUint16(char* des, const uint16_t* src, uint32_t encodeNum);
+	virtual int encodeUint8(char* des, const uint8_t* src, uint32_t encodeNum);
+
+	virtual std::string getCompressorName() {
+		return "gafor";
+	}
+	virtual Compressor* clone();
+
+	template<typename T>
+	int encode(char* des, const T* src, uint32_t encodeNum) const;
+
+protected:
+	virtual uint32_t windowLength() const {
+		return m_units << 3;
+	}
+
+private:
+	template<typename T>
+	int encodeWindow(char* des, const T* src, uint32_t nunits) const;
+
+	uint32_t m_units;	// # of 8 integers in a window
+	uint32_t m_minLog;	// log2 of the min/max # of 8 integers in a frame
+	uint32_t m_maxLog;
+};
+
+template<typename T>
+int GAFOR::encode(char* des, const T* src, uint32_t encodeNum) const {
+	uint32_t compLen = 0;
+	uint32_t encoded = 0;
+
+	// the tail of a list may make a short window
+	uint32_t nunits = encodeNum >> 3;
+	for (uint32_t u = 0; u < nunits; u += m_units) {
+		uint32_t n = (nunits - u < m_units) ? nunits - u : m_units;
+		compLen += (uint32_t) encodeWindow(des + compLen, src + encoded, n);
+		encoded += n << 3;
+	}
+
+	// 剩余不足8个integer
+	compLen += (uint32_t) VarByte::encode(des + compLen, src + encoded,
+			encodeNum - encoded);
+
+	return (int) compLen;
+}
+
+/*
+ * Find the frames of the fewest bytes in a window of nunits * 8
+ * integers. cost[u] is the bytes of the first u units, and a frame
+ * of the units [u - l, u) costs a header byte and l * width bytes.
+ */
+template<typename T>
+int GAFOR::encodeWindow(char* des, const T* src, uint32_t nunits) const {
+	uint32_t widths[GAFOR_MAX_WINDOWSZ / 8];
+	uint32_t cost[GAFOR_MAX_WINDOWSZ / 8 + 1];
+	uint8_t last[GAFOR_MAX_WINDOWSZ / 8 + 1];
+
+	// step1: OR of each 8 integers
+	for (uint32_t i = 0; i < nunits; ++i) {
+		T tmp = src[8 * i];
+		for (uint32_t j = 1; j < 8; ++j) {
+			tmp |= src[8 * i + j];
+		}
+		widths[i] = static_cast<uint32_t>(tmp);
+	}
+
+	// step2: dynamic programming, and longer frames win ties
+	cost[0] = 0;
+	last[0] = 0;
+	for (uint32_t u = 1; u <= nunits; ++u) {
+		cost[u] = UINT32_MAX;
+		for (int k = m_maxLog; k >= (int) m_minLog; --k) {
+			uint32_t l = 1U << k;
+			if (l > u || cost[u - l] == UINT32_MAX)
+				continue;
+
+			uint32_t ors = 0;
+			for (uint32_t v = u - l; v < u; ++v) {
+				ors |= widths[v];
+			}
+			uint32_t ebl = 32 - MSB32(ors);
+			if (ebl == 0) {	//encode 0
+				ebl = 1;
+			}
+
+			uint32_t c = cost[u - l] + 1 + l * ebl;
+			if (c < cost[u]) {
+				cost[u] = c;
+				last[u] = k;
+			}
+		}
+		// no frames end here since the min frame is too long
+		if (cost[u] == UINT32_MAX)
+			last[u] = 0xff;
+	}
+
+	// a tail shorter than the min frame takes 8-integer frames
+	uint32_t end = nunits;
+	while (last[end] == 0xff) {
+		end--;
+	}
+
+	// step3: backtrack, and emit frames from left to right
+	uint8_t frames[GAFOR_MAX_WINDOWSZ / 8];
+	uint32_t nframes = 0;
+	for (uint32_t u = end; u > 0; u -= 1U << last[u]) {
+		frames[nframes++] = last[u];
+	}
+	for (uint32_t i = end; i < nunits; ++i) {
+		frames[nframes++] = 0;
+	}
+	std::reverse(frames, frames + nframes - (nunits - end));
+
+	char *desBeg = des;
+	for (uint32_t i = 0, u = 0; i < nframes; ++i) {
+		uint32_t l = 1U << frames[i];
+		uint32_t ors = 0;
+		for (uint32_t v = u; v < u + l; ++v) {
+			ors |= widths[v];
+		}
+		uint32_t ebl = 32 - MSB32(ors);
+		if (ebl == 0) {
+			ebl = 1;
+		}
+
+		// frameLengthId is 0, 32 or 64 for 8, 16 or 32 integers
+		des += encodeFrame(des, src, frames[i] << 5, ebl);
+		src += l << 3;
+		u += l;
+	}
+	return des - desBeg;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* GAFOR_HPP_ */
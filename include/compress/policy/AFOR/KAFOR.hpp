@@ -19,8 +19,7 @@
 #include <misc/encoding_internals.hpp>
 #include <compress/policy/AFOR/Compressor.hpp>
 #include <compress/policy/AFOR/VArByte.hpp>
-#include <compress/policy/AFOR/KAFOR_pack.hpp>
-#include <compress/policy/AFOR/KAFOR_unpack.hpp>
+#include <compress/policy/AFOR/KAFOR_simd.hpp>
 
 namespace integer_encoding {
 namespace internals {
@@ -55,6 +54,13 @@ public:
 	void decodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
 			uint64_t nvalue) const;
 
+	// [len] and [nvalue] are in bytes as encodeArray writes back.
+	// Frames of the block are copied as they are, and new frames
+	// go after them with the headers.
+	void appendArray(const uint32_t *in, uint64_t len, uint64_t num,
+			const uint32_t *add, uint64_t addlen, uint32_t *out,
+			uint64_t *nvalue) const;
+
 	uint64_t require(uint64_t len) const;
 	/***************************************************************************/
 	virtual int
@@ -100,9 +106,11 @@ private:
 	uint32_t chooseBestConfig(const T *src,
 			KAFOR::KAFORConfig configArr[]) const;
 
+	// byteOffset is where the first frame starts in the first row
 	template<typename T>
 	uint32_t encodeAllFrames(char *des, const T *src,
-			const char* frameHeaderArr, uint32_t numFrames) const;
+			const char* frameHeaderArr, uint32_t numFrames,
+			uint32_t byteOffset = 0) const;
 
 protected:
 	static const uint32_t m_windowSize = 128;
@@ -221,6 +229,7 @@ int KAFOR::encodeBlock(char* des, const T* src, uint32_t encodeNum) const {
 	const char *frameHeaderArr = des;
 	des += totalNumFrameHeader;	// skip frame header area
 	*desInt = 4 + totalNumFrameHeader;// record the begin position of data segment
+	ASSERT(frameHeaderArr + totalNumFrameHeader == des);
 
 	// step 3: encode all frames
 	int compLen = encodeAllFrames(des, src, frameHeaderArr,
@@ -270,31 +279,32 @@ uint32_t KAFOR::decodeAllFrames(T* des, const char* src,
 
 	const uint32_t *srcInt = (const uint32_t *) src;
 	uint32_t byteOffset = 0;	// 0 to 3
-
-	FILE* stat = fopen("./share/kaforstatistics", "a");
+	const KAFORKernel *kernels = KAFORUnpackKernels();
+	const uint32_t dist = GetPrefetchConfig().blocks;
 
 	for (uint32_t i = 0; i < numFrames; ++i) {
 		uint8_t frameHeader = (uint8_t) frameHeaderArr[i];
 		uint32_t KAFORUnpackInfoIdx = (((uint32_t) frameHeader) << 2)
 				+ byteOffset;
-		if (KAFORUnpackInfoIdx >= 384)
-			std::cout << "wrong KAFORUnpackInfoIdx!" << KAFORUnpackInfoIdx
-					<< std::endl;
+		ASSERT(KAFORUnpackInfoIdx < 384);
 
 		const KAFORUnpackInfo &info = KAFORUnpackInfoArr[KAFORUnpackInfoIdx];
-		if (byteOffset << 3 != info.m_offset)
-			std::cout << "wrong info offset!" << (byteOffset << 3) << " "
-					<< info.m_offset << std::endl;
+		ASSERT(byteOffset << 3 == info.m_offset);
+
+		/*
+		 * Frames ahead are located by the size of this one. Frames are
+		 * small, so it prefetches without a branch, and a distance of 0
+		 * only touches the current frame.
+		 */
+		PREFETCH(srcInt + dist * info.m_wordSkipped);
 
-		info.m_subFunc((uint32_t *) des, srcInt);
+		kernels[KAFORUnpackInfoIdx]((uint32_t *) des, srcInt);
 		srcInt += info.m_wordSkipped;
 		des += info.m_intDecoded;
 		byteOffset = info.m_newOffset >> 3;
 
-		fwrite(&(info.m_intDecoded), 2, 1, stat);
+		ENCODING_STAT(STAT_KAFOR_FRAMELEN, info.m_intDecoded);
 	}
-	fflush(stat);
-	fclose(stat);
 
 	if (byteOffset > 0)
 		srcInt += 4;
@@ -332,11 +342,7 @@ uint32_t KAFOR::chooseBestConfig(const T *src,
 		}
 
 		// get effective bit length
-		uint32_t ebl = 0;
-		while (tmp > 0) {
-			ebl++;
-			tmp >>= 1;
-		}
+		uint32_t ebl = 32 - MSB32(static_cast<uint32_t>(tmp));
 		if (ebl == 0) {	//encode 0
 			ebl = 1;
 		}
@@ -391,32 +397,26 @@ uint32_t KAFOR::chooseBestConfig(const T *src,
 
 template<typename T>
 uint32_t KAFOR::encodeAllFrames(char *des, const T *src,
-		const char* frameHeaderArr, uint32_t numFrames) const {
-	uint32_t *desInt = (uint32_t*) des;
-	uint32_t byteOffset = 0;	// 0 to 3
+		const char* frameHeaderArr, uint32_t numFrames,
+		uint32_t byteOffset) const {
+	uint32_t *desInt = (uint32_t*) des;	// byteOffset is 0 to 3
+	const KAFORKernel *kernels = KAFORPackKernels();
 	for (uint32_t i = 0; i < numFrames; ++i) {
 		uint8_t frameHeader = (uint8_t) frameHeaderArr[i];
 		uint32_t KAFORPackInfoIdx = (((uint32_t) frameHeader) << 2)
 				+ byteOffset;	//id共有96种取值(0~95)，右移两位最大值383(+3)
-		if (KAFORPackInfoIdx >= 384)
-			std::cout << "wrong KAFORPackInfoIdx!" << KAFORPackInfoIdx
-					<< std::endl;
+		ASSERT(KAFORPackInfoIdx < 384);
 
 		const KAFORPackInfo &info = KAFORPackInfoArr[KAFORPackInfoIdx];
-		if (byteOffset << 3 != info.m_offset)
-			std::cout << "wrong info offset!" << (byteOffset << 3) << " "
-					<< info.m_offset << std::endl;
+		ASSERT(byteOffset << 3 == info.m_offset);
 
-		info.m_subFunc(desInt, (const uint32_t *) src);
+		kernels[KAFORPackInfoIdx](desInt, (const uint32_t *) src);
 		src += info.m_intEncoded;
 		desInt += info.m_wordSkipped;
 		byteOffset = info.m_newOffset >> 3;
 
 	}
 
-	if (frameHeaderArr + numFrames != des)
-		std::cout << "wrong frame num!" << std::endl;
-
 	if (byteOffset > 0)
 		desInt += 4;
 
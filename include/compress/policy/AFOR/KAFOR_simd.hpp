@@ -0,0 +1,72 @@
+/**
+ * filename:KAFOR_simd.hpp
+ * @brief: pack/unpack kernels for KAFOR frames
+ *         KAFOR stores four integers per bit slot, i.e., lane j of every
+ *         128-bit word group holds the bits of des[4 * i + j], so a whole
+ *         slot is processed by a single vector instruction. The kernels
+ *         follow the same (frame length, bit width, byte offset) indexing
+ *         as KAFORPackInfoArr/KAFORUnpackInfoArr, and the offsets and
+ *         skipped words are still taken from those tables.
+ * @data:2013-12-02
+ * @author:zxd
+ */
+
+#ifndef KAFOR_SIMD_HPP_
+#define KAFOR_SIMD_HPP_
+
+#include <stdint.h>
+
+namespace integer_encoding {
+namespace internals {
+
+typedef void (*KAFORKernel)(uint32_t *des, const uint32_t *src);
+
+/* 3 frame lengths * 32 bit widths * 4 byte offsets */
+const uint32_t KAFOR_NUM_KERNELS = 384;
+
+struct KAFORUnpackInfo {
+	KAFORKernel m_subFunc;
+	uint8_t m_offset;
+	uint8_t m_newOffset;
+	uint16_t m_wordSkipped;
+	uint16_t m_intDecoded;
+};
+
+struct KAFORPackInfo {
+	KAFORKernel m_subFunc;
+	uint8_t m_offset; // 写入位置相对于des起始地址的bit偏移
+	uint8_t m_newOffset; // 写完以后，des下一次可以写入的位置bit偏移
+	uint16_t m_wordSkipped; // 此次写入完全占用的uint32_t个数，如果没有写满则不算
+	uint16_t m_intEncoded; // 此次压缩的数字个数
+};
+
+/*
+ * Frames indexed by (frameHeader << 2) + byteOffset, whose m_subFunc
+ * are the scalar kernels
+ */
+extern const KAFORUnpackInfo KAFORUnpackInfoArr[KAFOR_NUM_KERNELS];
+extern const KAFORPackInfo KAFORPackInfoArr[KAFOR_NUM_KERNELS];
+
+/* Kernel levels, the best one supported by the running cpu is used */
+const int KAFOR_KERNEL_SCALAR = 0;
+const int KAFOR_KERNEL_SSE = 1;
+const int KAFOR_KERNEL_AVX2 = 2;
+
+/*
+ * Return the kernel tables indexed by (frameHeader << 2) + byteOffset,
+ * which are selected by GetSimdLevel() at the first call.
+ */
+const KAFORKernel *KAFORUnpackKernels();
+const KAFORKernel *KAFORPackKernels();
+
+/* Return kernel tables for a given level, used for tests */
+const KAFORKernel *KAFORUnpackKernels(int level);
+const KAFORKernel *KAFORPackKernels(int level);
+
+/* Return the selected level */
+int KAFORKernelLevel();
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* KAFOR_SIMD_HPP_ */
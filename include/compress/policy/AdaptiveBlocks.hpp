@@ -0,0 +1,84 @@
+/*-----------------------------------------------------------------------------
+ *  AdaptiveBlocks.hpp - A meta-codec to select a codec for each block
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ADAPTIVEBLOCKS_HPP__
+#define __ADAPTIVEBLOCKS_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+#include <compress/EncodingBase.hpp>
+#include <compress/policy/PForDelta.hpp>
+#include <compress/policy/Simple16.hpp>
+#include <compress/policy/VariableByte.hpp>
+#include <compress/policy/VSEncodingSimple.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+/* A default # of integers in a block, and the max of it */
+const uint32_t ADAPTIVE_BLOCKSZ = 256;
+const uint32_t ADAPTIVE_MAX_BLOCKSZ = 2048;
+
+/*
+ * Codecs that blocks select from, which are ordered by decoding
+ * speed. VariableByte is the last resort since it encodes any
+ * integer.
+ */
+const uint32_t ADAPTIVE_VSESIMPLE = 0;
+const uint32_t ADAPTIVE_P4D = 1;
+const uint32_t ADAPTIVE_SIMPLE16 = 2;
+const uint32_t ADAPTIVE_VBYTE = 3;
+const uint32_t ADAPTIVE_NCODECS = 4;
+
+/*
+ * AdaptiveBlocks splits a list into blocks of a fixed length,
+ * and encodes each block with a codec above. A block takes the
+ * smallest codec, or the fastest one if it is within (1 + slack)
+ * times the smallest. The format is as follows:
+ *
+ *    [block len][selectors][blocks]
+ *
+ * A selector has a codec in 2 bits and the size of a block in
+ * 14 bits, and two selectors are packed in a word.
+ */
+class AdaptiveBlocks : public EncodingBase {
+ public:
+  explicit AdaptiveBlocks(uint32_t blocksz = ADAPTIVE_BLOCKSZ,
+                          double slack = 0.0);
+  ~AdaptiveBlocks() throw();
+
+  void encodeArray(const uint32_t *in,
+                   uint64_t len,
+                   uint32_t *out,
+                   uint64_t *nvalue) const;
+
+  void decodeArray(const uint32_t *in,
+                   uint64_t len,
+                   uint32_t *out,
+                   uint64_t nvalue) const;
+
+  uint64_t require(uint64_t len) const;
+
+ private:
+  EncodingPtr codecs_[ADAPTIVE_NCODECS];
+  uint32_t    blocksz_;
+  double      slack_;
+}; /* AdaptiveBlocks */
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ADAPTIVEBLOCKS_HPP__ */
@@ -47,6 +47,14 @@ class PForDelta : public EncodingBase {
                    uint32_t *out,
                    uint64_t nvalue) const;
 
+  void appendArray(const uint32_t *in,
+                   uint64_t len,
+                   uint64_t num,
+                   const uint32_t *add,
+                   uint64_t addlen,
+                   uint32_t *out,
+                   uint64_t *nvalue) const;
+
   uint64_t require(uint64_t len) const;
 
  private:
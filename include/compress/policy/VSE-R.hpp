@@ -47,10 +47,6 @@ class VSE_R : public EncodingBase {
                    uint64_t nvalue) const;
 
   uint64_t require(uint64_t len) const;
-
- private:
-  // 构造函数中给它初始化指向MAXLEN长度的区域
-  std::shared_ptr<uint32_t>     wmem_;
 }; /* VSE_R */
 
 } /* namespace: internals */
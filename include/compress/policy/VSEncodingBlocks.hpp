@@ -29,6 +29,8 @@ namespace internals {
 class VSEncodingBlocks : public EncodingBase {
  public:
   VSEncodingBlocks();
+  explicit VSEncodingBlocks(const VSEPartitionConfig& conf);
+  explicit VSEncodingBlocks(std::shared_ptr<VSEncodingPartitioner> vdp);
   ~VSEncodingBlocks() throw();
 
   void encodeArray(const uint32_t *in,
@@ -41,6 +43,26 @@ class VSEncodingBlocks : public EncodingBase {
                    uint32_t *out,
                    uint64_t nvalue) const;
 
+  void appendArray(const uint32_t *in,
+                   uint64_t len,
+                   uint64_t num,
+                   const uint32_t *add,
+                   uint64_t addlen,
+                   uint32_t *out,
+                   uint64_t *nvalue) const;
+
+  /*
+   * encodeArrayParallel
+   *   Encode chunks of VSENCODING_BLOCKSZ integers concurrently,
+   *   and the output is the same with encodeArray().
+   *     nthreads : # of threads, and 0 means the OpenMP default
+   */
+  void encodeArrayParallel(const uint32_t *in,
+                           uint64_t len,
+                           uint32_t *out,
+                           uint64_t *nvalue,
+                           int nthreads = 0) const;
+
   uint64_t require(uint64_t len) const;
 
  private:
@@ -53,8 +75,7 @@ class VSEncodingBlocks : public EncodingBase {
                 uint32_t *out,
                 uint32_t nvalue) const;
 
-  std::shared_ptr<uint32_t>     wmem_;
-  std::shared_ptr<VSEncodingDP> vdp_;
+  std::shared_ptr<VSEncodingPartitioner>  vdp_;
 }; /* VSEncodingBlocks */
 
 } /* namespace: internals */
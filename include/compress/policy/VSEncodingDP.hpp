@@ -18,6 +18,7 @@
 #define __VSENCODINGDP_HPP__
 
 #include <misc/encoding_internals.hpp>
+#include <compress/policy/VSEncodingPartitioner.hpp>
 
 /*
  * If a list is larger that this value, then
@@ -31,7 +32,7 @@ const uint32_t VSENCODING_BLOCKSZ = 65536;
 namespace integer_encoding {
 namespace internals {
 
-class VSEncodingDP {
+class VSEncodingDP : public VSEncodingPartitioner {
 public:
 	explicit VSEncodingDP(const uint32_t *lens, const uint32_t *zlens,
 			uint32_t size, bool aligned);
@@ -47,15 +48,6 @@ public:
 	 */
 	void computePartition(const std::vector<uint32_t>& seq,
 			std::vector<uint32_t> *parts, uint32_t cost) const;
-
-private:
-	bool aligned_;
-	uint32_t size_; //输入序列长度
-	uint32_t mxblk_; //最大分块长度
-	const uint32_t *lens_; //指向一组可选的分块长度数组
-	const uint32_t *zlens_; //只在VSE_Blocks中使用了，用处暂时不明了
-
-	DISALLOW_COPY_AND_ASSIGN(VSEncodingDP);
 };
 /* VSEncodingDP */
 
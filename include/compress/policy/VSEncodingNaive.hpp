@@ -31,10 +31,29 @@
 namespace integer_encoding {
 namespace internals {
 
+/*
+ * A block starts with the codes of B and K in VSENAIVE_LOGLOG and
+ * VSENAIVE_LOGLEN bits, and VSE_R decodes the stream by itself.
+ */
+const uint32_t VSENAIVE_LOGLEN = 3;
+const uint32_t VSENAIVE_LOGLOG = 3;
+// 这个3是有问题的，因为b的取值范围是2^4个
+// 但naive的作用只是处理VSE-R的bit位数，故3足够了
+
+const uint32_t VSENAIVE_LENS_LEN = 1U << VSENAIVE_LOGLEN;
+
+// lens则存储了k所能取得的值
+const uint32_t VSENAIVE_LENS[] = { 1, 2, 4, 6, 8, 16, 32, 64 };
+
+// 这里的logs和remaplogs存储了b所能取得的值，即从13开始，向4的整数倍重映射
+const uint32_t VSENAIVE_LOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 16,
+		20, 32 };
+
 class VSEncodingNaive : public EncodingBase {
  public:
   VSEncodingNaive();
   explicit VSEncodingNaive(int policy);
+  explicit VSEncodingNaive(const VSEPartitionConfig& conf);
 
   ~VSEncodingNaive() throw();
 
@@ -51,7 +70,7 @@ class VSEncodingNaive : public EncodingBase {
   uint64_t require(uint64_t len) const;
 
  private:
-  std::shared_ptr<VSEncodingDP> vdp_;
+  std::shared_ptr<VSEncodingPartitioner> vdp_;
 }; /* VSEncodingNaive */
 
 } /* namespace: internals */
@@ -78,8 +78,6 @@ struct optimal_partition {
 	optimal_partition(const std::vector<element_t>& seq,
 			cost_t fixedCost = 64) {
 
-		FILE* stat = fopen("./share/oploops", "a");
-
 		ASSERT(seq.size() != 0);
 
 		//所有元素均使用32bit表示
@@ -159,9 +157,7 @@ struct optimal_partition {
 		 std::cout <<i<<":"<< bPath[i] << std::endl;*/
 		//XXX 3 in 3
 		//		std::cout << "times of loop: " << ind << std::endl;
-		fwrite(&ind, 4, 1, stat);
-		fflush(stat);
-		fclose(stat);
+		ENCODING_STAT(STAT_VSEOP_LOOPS, ind);
 
 		posIndex_t curr_pos = seq.size();
 		posIndex_t last_pos = curr_pos;
@@ -276,6 +272,109 @@ struct optimal_partition {
 		std::reverse(Ks.begin(), Ks.end());
 		cost_opt = min_cost[seq.size()];
 	}
+	/*
+	 * Partition an input sequence with limited options for k, where
+	 * a block of len integers from i costs cost(i, len) bits, and
+	 * a block of only 0 must have a length in zlens if it is given.
+	 * Each window keeps the end that it reached for i - 1, so only
+	 * the lengths that move the end forward are tried for i.
+	 */
+	template<class Cost>
+	optimal_partition(const std::vector<element_t>& seq, const element_t *lens,
+			const element_t *zlens, const uint32_t size, cost_t fixedCost,
+			double e1, double e2, const Cost& cost) :
+			partition(), Ks(), Bs(), eps1(e1), eps2(e2) {
+		ASSERT(seq.size() != 0);
+
+		posIndex_t n = seq.size();
+		std::vector<cost_t> min_cost(n + 1, UINT64_MAX);
+		std::vector<posIndex_t> path(n + 1, 0);
+		min_cost[0] = 0;
+
+		/* zfwd[i]是从i开始的0的个数 */
+		std::vector<posIndex_t> zfwd;
+		if (zlens != NULL) {
+			zfwd.assign(n + 1, 0);
+			for (posIndex_t i = n; i > 0; i--)
+				zfwd[i - 1] = (seq[i - 1] == 0) ? zfwd[i] + 1 : 0;
+		}
+
+		// one window for each power of (1 + eps2) up to fixedCost / eps1
+		std::vector<cost_t> bounds;
+		std::vector<posIndex_t> ends;
+		double cost_lower_bound = (fixedCost > 0) ? fixedCost : 1;
+		for (double b = cost_lower_bound;; b *= 1 + eps2) {
+			bounds.push_back(static_cast<cost_t>(b));
+			if (b >= cost_lower_bound / eps1)
+				break;
+		}
+		ends.assign(bounds.size(), 0);
+
+		int ind = 0;
+		auto relax = [&](posIndex_t i, posIndex_t len) {
+			cost_t c = cost(i, len);
+			if (min_cost[i] + c < min_cost[i + len]) {
+				min_cost[i + len] = min_cost[i] + c;
+				path[i + len] = i;
+			}
+			ind++;
+			return c;
+		};
+
+		for (posIndex_t i = 0; i < n; i++) {
+			if (min_cost[i] == UINT64_MAX)
+				continue;
+
+			/* 全0的块只能使用zlens中的长度 */
+			uint32_t l = 0;
+			if (zlens != NULL) {
+				for (uint32_t g = 0; g < size && zlens[g] <= zfwd[i]; g++)
+					relax(i, zlens[g]);
+				while (l < size && lens[l] <= zfwd[i])
+					l++;
+			}
+
+			// the shortest block always keeps a path to the end
+			if (l < size && i + lens[l] <= n)
+				relax(i, lens[l]);
+
+			posIndex_t last_end = i + 1;
+			for (uint32_t k = 0; k < bounds.size(); k++) {
+				if (last_end < ends[k])
+					last_end = ends[k];
+				while (l < size && i + lens[l] < last_end)
+					l++;
+				while (l < size && i + lens[l] <= n) {
+					if (relax(i, lens[l]) >= bounds[k])
+						break;
+					l++;
+				}
+				if (l == size || i + lens[l] > n)
+					break;
+				ends[k] = last_end = i + lens[l];
+			}
+		}
+		ENCODING_STAT(STAT_VSEOP_LOOPS, ind);
+		ASSERT(min_cost[n] != UINT64_MAX);
+
+		posIndex_t curr_pos = n;
+		while (curr_pos != 0) {
+			posIndex_t last_pos = path[curr_pos];
+			element_t maxB = 0;
+			for (posIndex_t g = last_pos; g < curr_pos; g++)
+				maxB = maxB > seq[g] ? maxB : seq[g];
+
+			partition.emplace_back(curr_pos);
+			Ks.emplace_back(curr_pos - last_pos);
+			Bs.emplace_back(maxB);
+			curr_pos = last_pos;
+		}
+		partition.emplace_back(0);
+		std::reverse(partition.begin(), partition.end());
+		std::reverse(Bs.begin(), Bs.end());
+		std::reverse(Ks.begin(), Ks.end());
+		cost_opt = min_cost[n];
+	}
 };
 }		//namespace:internals
 }		//namespace:integer_encoding
@@ -0,0 +1,256 @@
+/*-----------------------------------------------------------------------------
+ *  VSEncodingPartitioner.hpp - Strategies to partition a list for VSEncoding
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __VSENCODINGPARTITIONER_HPP__
+#define __VSENCODINGPARTITIONER_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+#include <compress/EncodingBase.hpp>
+
+#include <functional>
+
+namespace integer_encoding {
+namespace internals {
+
+/* Levels of the range-max table, so blocks are up to 255 long */
+const uint32_t VSEDP_RMQ_LEVELS = 8;
+
+/* The max # of admissible lengths, and bit widths are 0 to 32 */
+const uint32_t VSE_MAX_LENS = 16;
+const uint32_t VSE_MAX_LOGS = 33;
+
+/*
+ * Policies to partition a list
+ *    EXACT   : the optimal partition by dynamic programming
+ *    APPROX  : the sliding windows of optimal_partition with cost
+ *              bounds F(1 + eps2)^k up to F / eps1, which try only
+ *              the lengths that move a window end forward
+ *    GREEDY  : cut the cheapest block per integer from left
+ *              to right in linear time
+ */
+const int VSE_PARTITION_EXACT = 0;
+const int VSE_PARTITION_APPROX = 1;
+const int VSE_PARTITION_GREEDY = 2;
+
+/*
+ * NOTE: Set this to "exact", "greedy", "approx" or
+ * "approx:<eps1>:<eps2>" to change the default policy
+ * of VSEncoding codecs without recompiling.
+ */
+#define VSE_PARTITION_ENV  "INTEGER_ENCODING_VSE_PARTITION"
+
+/*
+ * NOTE: Set VSE_LAMBDA_ENV to a trade-off in bits per nanosecond
+ * of decoding to add decode costs to the objective, and set
+ * VSE_DCOST_ENV to a file saved by VSEDecodeCost::save() to skip
+ * calibrating the costs at startup.
+ */
+#define VSE_LAMBDA_ENV  "INTEGER_ENCODING_VSE_LAMBDA"
+#define VSE_DCOST_ENV   "INTEGER_ENCODING_VSE_DCOST"
+
+/* Decode costs in nanoseconds of a block indexed by (b, k) */
+class VSEDecodeCost {
+ public:
+  VSEDecodeCost();
+
+  double get(uint32_t b, uint32_t k) const {
+    ASSERT(b < VSE_MAX_LOGS && k < VSE_MAX_LENS);
+    return ns_[b][k];
+  }
+
+  void set(uint32_t b, uint32_t k, double ns) {
+    ASSERT(b < VSE_MAX_LOGS && k < VSE_MAX_LENS);
+    ns_[b][k] = ns;
+  }
+
+  /* A text file that has a line of "b k ns" for each entry */
+  bool load(const char *path);
+  bool save(const char *path) const;
+
+ private:
+  double ns_[VSE_MAX_LOGS][VSE_MAX_LENS];
+};
+
+/*
+ * A config of partitioners
+ *    policy  : one of VSE_PARTITION_*
+ *    eps1/2  : parameters for VSE_PARTITION_APPROX
+ *    lambda  : bits that a nanosecond of decoding is worth, and
+ *              0 means partitions only minimize space
+ *    dcost   : decode costs, and codecs calibrate their own costs
+ *              if lambda > 0 and it is not given
+ */
+struct VSEPartitionConfig {
+  int     policy;
+  double  eps1;
+  double  eps2;
+  double  lambda;
+  std::shared_ptr<const VSEDecodeCost> dcost;
+
+  explicit VSEPartitionConfig(int p = VSE_PARTITION_EXACT,
+                              double e1 = 0.03, double e2 = 0.3)
+      : policy(p), eps1(e1), eps2(e2), lambda(0.0), dcost() {}
+};
+
+/* Range-max queries over a list in O(1) */
+class VSERangeMax {
+ public:
+  VSERangeMax() {}
+
+  void build(const std::vector<uint32_t>& seq, uint32_t levels);
+
+  /* Return the max of seq[j, j + len), and 0 < len < 2^levels */
+  uint32_t query(uint64_t j, uint64_t len) const {
+    uint32_t k = 31 - MSB32(static_cast<uint32_t>(len));
+    uint32_t a = rmq_[k][j];
+    uint32_t b = rmq_[k][j + len - (uint64_t(1) << k)];
+    return (a < b)? b : a;
+  }
+
+ private:
+  std::vector<uint32_t> rmq_[VSEDP_RMQ_LEVELS];
+
+  DISALLOW_COPY_AND_ASSIGN(VSERangeMax);
+};
+
+/*
+ * A base of partitioners. A block that has only 0 must have
+ * a length in zlens_[] if it is given, and the others must
+ * have lengths in lens_[].
+ */
+class VSEncodingPartitioner {
+ public:
+  explicit VSEncodingPartitioner(const uint32_t *lens,
+                                 const uint32_t *zlens,
+                                 uint32_t size, bool aligned);
+  virtual ~VSEncodingPartitioner() throw();
+
+  /*
+   * computePartition
+   *   Compute sub-lists from input a list
+   *     seq    : input list
+   *     parts  : calculated sub-lists
+   *     cost   : fix cost in bits that we pay for each block
+   */
+  virtual void computePartition(const std::vector<uint32_t>& seq,
+                                std::vector<uint32_t> *parts,
+                                uint32_t cost) const = 0;
+
+  /*
+   * setDecodeCost
+   *   Add lambda * dcost.get(b, k) to the cost of each block, which
+   *   are rounded to bits
+   */
+  void setDecodeCost(const VSEDecodeCost& dcost, double lambda);
+
+ protected:
+  uint64_t blockCost(uint64_t len, uint32_t maxB,
+                     uint32_t fixedCost) const {
+    uint64_t c = fixedCost + ((aligned_)?
+        DIV_ROUNDUP(len * maxB, 32) : len * maxB);
+    if (!tcost_.empty())
+      c += tcost_[maxB * (mxblk_ + 1) + len];
+    return c;
+  }
+
+  bool aligned_;
+  uint32_t size_;
+  uint32_t mxblk_;
+  uint32_t levels_;
+  const uint32_t *lens_;
+  const uint32_t *zlens_;
+
+  /* Decode costs in bits indexed by (maxB, len) */
+  std::vector<uint32_t> tcost_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(VSEncodingPartitioner);
+};
+
+class VSEncodingApprox : public VSEncodingPartitioner {
+ public:
+  explicit VSEncodingApprox(const uint32_t *lens, const uint32_t *zlens,
+                            uint32_t size, bool aligned,
+                            double eps1, double eps2);
+  ~VSEncodingApprox() throw();
+
+  void computePartition(const std::vector<uint32_t>& seq,
+                        std::vector<uint32_t> *parts,
+                        uint32_t cost) const;
+
+ private:
+  double eps1_;
+  double eps2_;
+};
+
+class VSEncodingGreedy : public VSEncodingPartitioner {
+ public:
+  explicit VSEncodingGreedy(const uint32_t *lens, const uint32_t *zlens,
+                            uint32_t size, bool aligned);
+  ~VSEncodingGreedy() throw();
+
+  void computePartition(const std::vector<uint32_t>& seq,
+                        std::vector<uint32_t> *parts,
+                        uint32_t cost) const;
+};
+
+/* Parse a policy in the format of VSE_PARTITION_ENV */
+bool ParseVSEPartitionConfig(const char *str, VSEPartitionConfig *conf);
+
+/*
+ * The default config that VSEncoding codecs use, which is read
+ * from VSE_PARTITION_ENV at first. It is not thread-safe to set
+ * it while codecs are created.
+ */
+const VSEPartitionConfig& GetVSEPartitionConfig();
+void SetVSEPartitionConfig(const VSEPartitionConfig& conf);
+
+std::shared_ptr<VSEncodingPartitioner> CreateVSEPartitioner(
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned, const VSEPartitionConfig& conf);
+
+/*
+ * CalibrateVSEDecodeCost
+ *   Time decoding of a codec for each (b, k), where every block
+ *   of a list has a width b and the k-th length
+ *     remaplogs : widths that the codec maps b to
+ *     create    : make the codec with a given partitioner
+ */
+typedef std::function<EncodingPtr(
+    std::shared_ptr<VSEncodingPartitioner>)> VSECodecCreator;
+
+std::shared_ptr<const VSEDecodeCost> CalibrateVSEDecodeCost(
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned,
+    const uint32_t *remaplogs, const VSECodecCreator& create);
+
+/*
+ * ResolveVSEPartitionConfig
+ *   Return conf with the decode costs of a codec if lambda > 0 and
+ *   no costs are given, which are calibrated at the first call
+ *   for each lens and shared by later calls
+ */
+VSEPartitionConfig ResolveVSEPartitionConfig(
+    const VSEPartitionConfig& conf,
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned,
+    const uint32_t *remaplogs, const VSECodecCreator& create);
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __VSENCODINGPARTITIONER_HPP__ */
@@ -30,6 +30,8 @@ class VSEncodingRest : public EncodingBase {
  public:
   VSEncodingRest();
   explicit VSEncodingRest(int policy);
+  explicit VSEncodingRest(const VSEPartitionConfig& conf);
+  explicit VSEncodingRest(std::shared_ptr<VSEncodingPartitioner> vdp);
 
   ~VSEncodingRest() throw();
 
@@ -43,16 +45,10 @@ class VSEncodingRest : public EncodingBase {
                    uint32_t *out,
                    uint64_t nvalue) const;
 
-  /* FIXME: VSEncodingRest rewrites its own input integers */
-  void decodeArray(uint32_t *in,
-                   uint64_t len,
-                   uint32_t *out,
-                   uint64_t nvalue) const;
-
   uint64_t require(uint64_t len) const;
 
  private:
-  std::shared_ptr<VSEncodingDP> vdp_;
+  std::shared_ptr<VSEncodingPartitioner> vdp_;
 }; /* VSEncodingRest */
 
 } /* namespace: internals */
@@ -46,6 +46,8 @@ namespace internals {
 class VSEncodingSimple : public EncodingBase {
  public:
   VSEncodingSimple();
+  explicit VSEncodingSimple(const VSEPartitionConfig& conf);
+  explicit VSEncodingSimple(std::shared_ptr<VSEncodingPartitioner> vdp);
   ~VSEncodingSimple() throw();
 
   void encodeArray(const uint32_t *in,
@@ -61,15 +63,17 @@ class VSEncodingSimple : public EncodingBase {
   uint64_t require(uint64_t len) const;
 
  private:
-  /*
-   * FIXME: It is wasteful to allocate memory
-   * in advance, so decodeArray needs to be
-   * modified in a similar way of VSEncodingBlocks,
-   * that is, it splits the constant chunk and
-   * compress each chunk.
-   */
-  std::shared_ptr<void *>       jtable_;
-  std::shared_ptr<VSEncodingDP> vdp_;
+  /* Lists are split into chunks of VSENCODING_BLOCKSZ */
+  void encodeVS(const uint32_t *in,
+                uint32_t len,
+                uint32_t *out,
+                uint32_t *nvalue) const;
+  void decodeVS(const uint32_t *in,
+                uint32_t len,
+                uint32_t *out,
+                uint32_t nvalue) const;
+
+  std::shared_ptr<VSEncodingPartitioner>  vdp_;
 }; /* VSEncodingSimple */
 
 } /* namespace: internals */
@@ -0,0 +1,55 @@
+/*-----------------------------------------------------------------------------
+ *  decMulti.hpp - Transformation tables that decode several Gamma/Delta
+ *                 codes in a single 16-bit lookup
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __DECMULTI_HPP__
+#define __DECMULTI_HPP__
+
+#include <stdint.h>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * Each entry holds the values of the codes that fit completely
+ * in a 16-bit window, and the total number of bits they consume.
+ * [num] is 0 if the first code is longer than 16 bits. Gamma
+ * values in a window are less than 255, and delta ones are less
+ * than 1023, so both entries are packed in 64 bits.
+ */
+const uint32_t MULTI_GAMMA_MAX = 6;
+const uint32_t MULTI_DELTA_MAX = 3;
+
+struct MultiGammaEntry {
+  uint8_t   num;
+  uint8_t   bits;
+  uint8_t   vals[MULTI_GAMMA_MAX];
+};
+
+struct MultiDeltaEntry {
+  uint8_t   num;
+  uint8_t   bits;
+  uint16_t  vals[MULTI_DELTA_MAX];
+};
+
+/* Tables with 65536 entries, which are built at the first call */
+const MultiGammaEntry *decMultiGamma();
+const MultiDeltaEntry *decMultiDelta();
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __DECMULTI_HPP__ */
@@ -41,6 +41,10 @@
 #include <compress/policy/VSEncodingSimple.hpp>
 #include <compress/policy/AFOR/KAFOR.hpp>
 #include <compress/policy/AFOR/AFOR.hpp>
+#include <compress/policy/AFOR/GAFOR.hpp>
+#include <compress/policy/AdaptiveBlocks.hpp>
+#include <compress/ChunkedEncoding.hpp>
+#include <compress/ListContainer.hpp>
 
 namespace integer_encoding {
 
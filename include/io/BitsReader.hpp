@@ -23,10 +23,14 @@
 #include <compress/policy/decUnary.hpp>
 #include <compress/policy/decGamma.hpp>
 #include <compress/policy/decDelta.hpp>
+#include <compress/policy/decMulti.hpp>
 
 namespace integer_encoding {
 namespace internals {
 
+/* Words a reader leaves to the checked path */
+const uint32_t BITSRD_SLACK = 4;
+
 class BitsReader {
 public:
 	explicit BitsReader(const uint32_t *in, uint64_t len);
@@ -35,6 +39,36 @@ public:
 	uint32_t read_bits(uint32_t num);
 	const uint32_t *pos() const;
 
+	/*
+	 * Primitives for table decoders. While unchecked() is true, at
+	 * least BITSRD_SLACK words are left, so peek() and consume() of
+	 * up to 32 bits, or a single code up to 96 bits, need no bounds
+	 * check. peek() fetches 64 bits with one unaligned load.
+	 */
+	bool unchecked() const {
+		return in_ < fast_;
+	}
+
+	uint32_t peek(uint32_t num) const {
+		ASSERT(num <= 32);
+		uint64_t w = BYTEORDER_FREE_LOAD64(in_);
+		w = ((w << 32) | (w >> 32)) << off_;
+		return (w >> 32) >> (32 - num);
+	}
+
+	void consume(uint32_t num) {
+		ASSERT(num <= 32);
+		off_ += num;
+		in_ += off_ >> 5;
+		off_ &= 31;
+	}
+
+	uint32_t fetch(uint32_t num) {
+		uint32_t val = peek(num);
+		consume(num);
+		return val;
+	}
+
 	/* Decoders for gamma alternatives */
 	void ngammaArray(uint32_t *out, uint64_t nvalues);
 	void fgammaArray(uint32_t *out, uint64_t nvalues);
@@ -68,13 +102,21 @@ private:
 	uint32_t read_fgdelta();
 	uint32_t read_fudelta();
 
+	/* Unchecked decoders used while unchecked() is true */
+	uint32_t fetch_ngamma();
+	uint32_t fetch_ndelta();
+
 	/* A single value decoder for binary interpolative */
 	uint32_t read_intrpolatv(uint32_t intvl);
 
+	/* Checked primitives for the tail of the input */
+	uint64_t left() const;
+	uint32_t peek_tail(uint32_t num) const;
+
 	const uint32_t *in_;
 	const uint32_t *term_;
-	uint64_t buffer_;
-	uint32_t fill_;
+	const uint32_t *fast_;
+	uint32_t off_;
 
 	DISALLOW_COPY_AND_ASSIGN(BitsReader);
 };
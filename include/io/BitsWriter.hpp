@@ -30,6 +30,9 @@ class BitsWriter {
   void write_bits(uint32_t val, uint32_t num);
   void flush_bits();
 
+  /* Write [n] values in [b] bits each, used for constant-width runs */
+  void write_fixed_array(const uint32_t *in, uint64_t n, uint32_t b);
+
   uint32_t *pos() const;
   uint64_t size() const;
 
@@ -45,7 +48,11 @@ class BitsWriter {
                        uint32_t low, uint32_t high);
 
  private:
-  void write_unary(uint32_t val);
+  void put_bits(uint32_t val, uint32_t num);
+  void reserve_bits(uint64_t num) const;
+
+  /* Write a code up to 64 bits at once */
+  void write_code(uint64_t code, uint32_t num);
   void write_gamma(uint32_t val);
   void write_intrpolatv(uint32_t val, uint32_t intvl);
 
@@ -0,0 +1,86 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_aio.hpp - Batched reads of a file with io_uring
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_AIO_HPP__
+#define __ENCODING_AIO_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+#include <functional>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * NOTE: Set this to "pread" to use threads of pread for tests
+ * and benchmarks, even if io_uring works.
+ */
+#define AIO_MODE_ENV  "INTEGER_ENCODING_AIO"
+
+/* Rings of io_uring, which are defined on platforms with it */
+struct AioRing;
+
+/* A read of [len] bytes at [off] of a file into [buf] */
+struct AioRequest {
+  void      *buf;
+  uint64_t  off;
+  uint64_t  len;
+};
+
+/*
+ * AioReader
+ *   Read a batch of requests from a file. io_uring keeps up to
+ *   [depth] reads in flight, and done(i) is called in a caller
+ *   thread as soon as the i-th request completes. If the kernel
+ *   has no io_uring, has no reads on it (before Linux 5.6) or
+ *   denies it, [nthreads] threads pread the requests instead, and
+ *   done(i) is called in each of them.
+ *
+ *   done() may throw an exception, and it is re-thrown after
+ *   all reads in flight complete, as errors of the ring are.
+ */
+class AioReader {
+ public:
+  typedef std::function<void(uint64_t i)> done_t;
+
+  /* [nthreads] of 0 means the OpenMP default */
+  AioReader(int fd, uint32_t depth, int nthreads = 0);
+  ~AioReader() throw();
+
+  /* Whether io_uring is used */
+  bool async() const {
+    return ring_ != NULL;
+  }
+
+  void read(const AioRequest *reqs, uint64_t n, const done_t& done);
+
+ private:
+  void readRing(const AioRequest *reqs, uint64_t n, const done_t& done);
+  void readThreads(const AioRequest *reqs, uint64_t n,
+                   const done_t& done);
+
+  int       fd_;
+  uint32_t  depth_;
+  int       nthreads_;
+  AioRing   *ring_;
+
+  DISALLOW_COPY_AND_ASSIGN(AioReader);
+}; /* AioReader */
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_AIO_HPP__ */
@@ -0,0 +1,248 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_bitpack.hpp - Bit-packing kernels generated by templates
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_BITPACK_HPP__
+#define __ENCODING_BITPACK_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * Orders of values in a 32-bit word
+ *    LSB : the first value takes the lowest bits, as AFOR does
+ *    MSB : the first value takes the highest bits, as BitsWriter,
+ *          PForDelta and VSEncoding codecs do
+ *
+ * In both orders, a value that does not fit in a word continues
+ * in the next one.
+ */
+const int BITPACK_LSB = 0;
+const int BITPACK_MSB = 1;
+
+/* The fewest values of B bits that fill up whole words */
+constexpr uint32_t BitPackGcd(uint32_t a, uint32_t b) {
+  return (b == 0)? a : BitPackGcd(b, a % b);
+}
+
+constexpr uint32_t BitPackGroup(uint32_t b) {
+  return (b == 0)? 32 : 32 / BitPackGcd(b, 32);
+}
+
+namespace bitpack {
+
+constexpr uint32_t Mask(uint32_t b) {
+  return (b >= 32)? 0xffffffff : (1U << b) - 1;
+}
+
+/* Shifts that take 0 for counts of 32 or more */
+template <uint32_t S>
+FORCE_INLINE uint32_t Shl(uint32_t v) {
+  return (S >= 32)? 0 : v << (S & 31);
+}
+
+template <uint32_t S>
+FORCE_INLINE uint32_t Shr(uint32_t v) {
+  return (S >= 32)? 0 : v >> (S & 31);
+}
+
+/*
+ * Packing and unpacking of the I-th value, which are unrolled
+ * by instantiating the next one. Value I takes bits from S in
+ * the W-th word, and it spans two words if S + B > 32.
+ */
+template <int O, uint32_t B, uint32_t N, uint32_t I, typename T>
+struct Step {
+  static const uint32_t W = (I * B) >> 5;
+  static const uint32_t S = (I * B) & 31;
+  static const bool     SPAN = (S + B > 32);
+
+  static FORCE_INLINE void pack(uint32_t * restrict out,
+                          const T * restrict in, uint32_t acc) {
+    uint32_t v = static_cast<uint32_t>(in[I]) & Mask(B);
+
+    if (O == BITPACK_LSB) {
+      acc |= Shl<S>(v);
+      if (S + B >= 32) {
+        BYTEORDER_FREE_STORE32(out + W, acc);
+        acc = Shr<32 - S>(v);
+      }
+    } else {
+      acc |= (SPAN)? Shr<S + B - 32>(v) : Shl<32 - S - B>(v);
+      if (S + B >= 32) {
+        BYTEORDER_FREE_STORE32(out + W, acc);
+        acc = Shl<64 - S - B>(v);
+      }
+    }
+
+    Step<O, B, N, I + 1, T>::pack(out, in, acc);
+  }
+
+  /*
+   * The W-th word is passed in [w], so each word is loaded once
+   * even if [out] and [in] are not known to be disjoint after
+   * kernels are inlined.
+   */
+  static FORCE_INLINE void unpack(T * restrict out,
+                            const uint32_t * restrict in, uint32_t w) {
+    static const bool NEXT = SPAN || (S + B == 32 && I + 1 < N);
+
+    uint32_t v;
+    uint32_t u = (NEXT)? BYTEORDER_FREE_LOAD32(in + W + 1) : 0;
+
+    if (O == BITPACK_LSB) {
+      v = Shr<S>(w);
+      if (SPAN)
+        v |= Shl<32 - S>(u);
+    } else {
+      if (SPAN)
+        v = Shl<S + B - 32>(w) | Shr<64 - S - B>(u);
+      else
+        v = Shr<32 - S - B>(w);
+    }
+
+    out[I] = static_cast<T>(v & Mask(B));
+    Step<O, B, N, I + 1, T>::unpack(out, in, (S + B >= 32)? u : w);
+  }
+};
+
+template <int O, uint32_t B, uint32_t N, typename T>
+struct Step<O, B, N, N, T> {
+  static FORCE_INLINE void pack(uint32_t * restrict out,
+                          const T * restrict in, uint32_t acc) {
+    /* Flush a word that is partially filled */
+    if ((N * B) & 31)
+      BYTEORDER_FREE_STORE32(out + ((N * B) >> 5), acc);
+  }
+
+  static FORCE_INLINE void unpack(T * restrict out,
+                            const uint32_t * restrict in, uint32_t w) {}
+};
+
+/* Values of 0 bits take no words */
+template <int O, uint32_t N, typename T>
+struct Step<O, 0, N, 0, T> {
+  static FORCE_INLINE void pack(uint32_t * restrict out,
+                          const T * restrict in, uint32_t acc) {}
+
+  static FORCE_INLINE void unpack(T * restrict out,
+                            const uint32_t * restrict in, uint32_t w) {
+    for (uint32_t i = 0; i < N; i++)
+      out[i] = 0;
+  }
+};
+
+} /* namespace: bitpack */
+
+/*
+ * BitPack
+ *   Pack [N] values of [in] into DIV_ROUNDUP(N * B, 32) words of
+ *   [out], where the upper bits of values are ignored
+ */
+template <int O, uint32_t B, uint32_t N, typename T>
+FORCE_INLINE void BitPack(uint32_t * restrict out, const T * restrict in) {
+  bitpack::Step<O, B, N, 0, T>::pack(out, in, 0);
+}
+
+/*
+ * BitUnpack
+ *   Unpack [N] values of B bits from [in] into [out]
+ */
+template <int O, uint32_t B, uint32_t N, typename T>
+FORCE_INLINE void BitUnpack(T * restrict out, const uint32_t * restrict in) {
+  bitpack::Step<O, B, N, 0, T>::unpack(
+      out, in, (B != 0)? BYTEORDER_FREE_LOAD32(in) : 0);
+}
+
+/*
+ * BitUnpackGroups
+ *   Unpack [n] values by groups of BitPackGroup(B). It writes up
+ *   to the end of the last group, so [out] needs the room for it.
+ */
+template <int O, uint32_t B>
+inline void BitUnpackGroups(uint32_t * restrict out,
+                            const uint32_t * restrict in,
+                            uint32_t n) {
+  const uint32_t G = BitPackGroup(B);
+  for (uint32_t i = 0; i < n; i += G, out += G, in += (G * B) >> 5)
+    BitUnpack<O, B, G, uint32_t>(out, in);
+}
+
+#define BITPACK_KERNELS(__f__)                                  \
+  { __f__<0>,  __f__<1>,  __f__<2>,  __f__<3>,  __f__<4>,       \
+    __f__<5>,  __f__<6>,  __f__<7>,  __f__<8>,  __f__<9>,       \
+    __f__<10>, __f__<11>, __f__<12>, __f__<13>, __f__<14>,      \
+    __f__<15>, __f__<16>, __f__<17>, __f__<18>, __f__<19>,      \
+    __f__<20>, __f__<21>, __f__<22>, __f__<23>, __f__<24>,      \
+    __f__<25>, __f__<26>, __f__<27>, __f__<28>, __f__<29>,      \
+    __f__<30>, __f__<31>, __f__<32> }
+
+/* Kernels of BitPack() and BitUnpack() indexed by widths */
+template <int O, uint32_t N, typename T>
+struct BitPackKernels {
+  typedef void (*pack_t)(uint32_t *out, const T *in);
+  typedef void (*unpack_t)(T *out, const uint32_t *in);
+
+  static const pack_t   pack[33];
+  static const unpack_t unpack[33];
+
+ private:
+  template <uint32_t B>
+  static void packB(uint32_t *out, const T *in) {
+    BitPack<O, B, N, T>(out, in);
+  }
+
+  template <uint32_t B>
+  static void unpackB(T *out, const uint32_t *in) {
+    BitUnpack<O, B, N, T>(out, in);
+  }
+};
+
+template <int O, uint32_t N, typename T>
+const typename BitPackKernels<O, N, T>::pack_t
+    BitPackKernels<O, N, T>::pack[33] = BITPACK_KERNELS(packB);
+
+template <int O, uint32_t N, typename T>
+const typename BitPackKernels<O, N, T>::unpack_t
+    BitPackKernels<O, N, T>::unpack[33] = BITPACK_KERNELS(unpackB);
+
+/* Kernels of BitUnpackGroups() indexed by widths */
+template <int O>
+struct BitUnpackGroupKernels {
+  typedef void (*unpack_t)(uint32_t *out,
+                           const uint32_t *in,
+                           uint32_t n);
+
+  static const unpack_t unpack[33];
+
+ private:
+  template <uint32_t B>
+  static void unpackB(uint32_t *out, const uint32_t *in, uint32_t n) {
+    BitUnpackGroups<O, B>(out, in, n);
+  }
+};
+
+template <int O>
+const typename BitUnpackGroupKernels<O>::unpack_t
+    BitUnpackGroupKernels<O>::unpack[33] = BITPACK_KERNELS(unpackB);
+
+#undef BITPACK_KERNELS
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_BITPACK_HPP__ */
@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_dispatch.hpp - Run-time selection of SIMD kernels
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_DISPATCH_HPP__
+#define __ENCODING_DISPATCH_HPP__
+
+#include <cstdint>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * SIMD levels in the order of capabilities. The library is
+ * built with -msse2, and faster kernels are bound at run-time
+ * by probing cpuid once. BMI2 is regarded as a part of AVX2.
+ */
+const int SIMD_SCALAR = 0;
+const int SIMD_SSE2 = 1;
+const int SIMD_SSE41 = 2;
+const int SIMD_AVX2 = 3;
+const int SIMD_AVX512 = 4;
+
+/*
+ * NOTE: Set this to "scalar", "sse2", "sse4.1", "avx2" or
+ * "avx512" to force a level for benchmarks. A level that
+ * the cpu does not support is capped to the detected one.
+ */
+#define SIMD_LEVEL_ENV  "INTEGER_ENCODING_SIMD"
+
+struct CpuFeatures {
+  bool  sse2;
+  bool  sse41;
+  bool  sse42;
+  bool  avx2;
+  bool  bmi2;
+  bool  avx512f;
+};
+
+/*
+ * Kernels bound to a level
+ *    copy  : copy [n] 32-bit values from [src] to [dest], and
+ *            it overruns up to the next 128-bit boundary as
+ *            MEMCPY does
+ *    zero  : fill [n] 32-bit values with 0 in the same way
+ *    dgap  : restore a list of d-gaps in place, that is,
+ *            list[i] = (prev += list[i] + 1), and return the
+ *            last value
+ *    crc32c: update a CRC-32C (Castagnoli) of [n] bytes from
+ *            a finalized [crc], which is 0 at first. SSE4.2
+ *            binds it at SIMD_SSE41 or higher if the cpu has it.
+ */
+typedef void (*copy_kernel_t)(uint32_t *dest,
+                              const uint32_t *src,
+                              uint64_t n);
+typedef void (*zero_kernel_t)(uint32_t *dest, uint64_t n);
+typedef uint32_t (*dgap_kernel_t)(uint32_t *list,
+                                  uint64_t n,
+                                  uint32_t prev);
+typedef uint32_t (*crc32c_kernel_t)(uint32_t crc,
+                                    const void *buf,
+                                    uint64_t n);
+
+struct SimdKernels {
+  int             level;
+  copy_kernel_t   copy;
+  zero_kernel_t   zero;
+  dgap_kernel_t   dgap;
+  crc32c_kernel_t crc32c;
+};
+
+const CpuFeatures& GetCpuFeatures();
+
+/* The detected level, capped by SIMD_LEVEL_ENV */
+int GetSimdLevel();
+const char *GetSimdLevelName(int level);
+
+/* Kernels for the current level */
+const SimdKernels& GetSimdKernels();
+
+/*
+ * The same kernels, which are bound once at startup so that hot
+ * paths like MEMCPY() only load a pointer. They are the scalar
+ * ones until then, so static initializers can use them as well.
+ */
+extern const SimdKernels *simdKernels;
+
+/*
+ * Kernels for a given level, which is capped by the
+ * detected one. It is used by tests and benchmarks.
+ */
+const SimdKernels& GetSimdKernels(int level);
+
+/* A CRC-32C of [n] bytes by the kernel for the current level */
+inline uint32_t Crc32c(const void *buf, uint64_t n, uint32_t crc = 0) {
+  return simdKernels->crc32c(crc, buf, n);
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_DISPATCH_HPP__ */
@@ -0,0 +1,75 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_hugepage.hpp - Buffers and mappings on huge pages
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_HUGEPAGE_HPP__
+#define __ENCODING_HUGEPAGE_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * NOTE: Set this to "1" to put large buffers and index files on
+ * huge pages, which is off by default.
+ */
+#define HUGEPAGE_ENV  "INTEGER_ENCODING_HUGEPAGE"
+
+/* The size of a huge page on x86-64 */
+const uint64_t HUGEPAGE_SZ = 2ULL << 20;
+
+bool IsHugePageEnabled();
+void SetHugePageEnabled(bool enabled);
+
+/*
+ * AllocBuffer
+ *   Allocate [n] bytes. If huge pages are enabled, buffers of
+ *   HUGEPAGE_SZ or more are aligned to huge pages, and they come
+ *   from MAP_HUGETLB if the kernel has reserved pages, or else
+ *   from transparent huge pages. [huge] tells FreeBuffer() which
+ *   one is used. It throws std::bad_alloc as new does.
+ */
+void *AllocBuffer(uint64_t n, bool *huge);
+void FreeBuffer(void *addr, uint64_t n, bool huge);
+
+/*
+ * Ask the kernel to back a mapping with transparent huge pages
+ * if they are enabled. It is only a hint, and file mappings get
+ * them only on filesystems that support large folios.
+ */
+void AdviseHugePages(void *addr, uint64_t n);
+
+/* A buffer of [n] values that AllocBuffer() allocates */
+template <typename T>
+std::shared_ptr<T> MakeBuffer(uint64_t n) {
+  static_assert(std::is_trivial<T>::value,
+                "Buffers take trivial types only");
+
+  uint64_t size = sizeof(T) * n;
+  bool huge = false;
+  T *addr = static_cast<T *>(AllocBuffer(size, &huge));
+
+  return std::shared_ptr<T>(addr, [size, huge](T *p) {
+    FreeBuffer(p, size, huge);
+  });
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_HUGEPAGE_HPP__ */
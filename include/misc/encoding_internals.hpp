@@ -22,6 +22,10 @@
 #endif
 
 #include <misc/encoding_port_internals.hpp>
+#include <misc/encoding_dispatch.hpp>
+#include <misc/encoding_stats.hpp>
+#include <misc/encoding_prefetch.hpp>
+#include <misc/encoding_hugepage.hpp>
 
 #include <cstdio>
 #include <cstdlib>
@@ -53,16 +57,16 @@ namespace integer_encoding {
  */
 #define DECODE_REQUIRE_MEM(x)   ((x) + 128)
 
-/* Smart pointer stuffs */
+/*
+ * Smart pointer stuffs. Large buffers go on huge pages if they
+ * are enabled, e.g., by HUGEPAGE_ENV.
+ */
 #define INITIALIZE_SPTR(__type__, __size__)  \
-    std::shared_ptr<__type__>(  \
-        new __type__[__size__], \
-        std::default_delete<__type__[]>())
+    ::integer_encoding::internals::MakeBuffer<__type__>(__size__)
 
 #define REGISTER_VECTOR_RAII(__type__, __name__, __size__)  \
     std::shared_ptr<__type__>   \
-        __##__name__(new __type__[__size__],  \
-                     std::default_delete<__type__[]>());    \
+        __##__name__(INITIALIZE_SPTR(__type__, __size__));  \
     __type__ *__name__ = __##__name__.get()
 
 /* Assertion macros */
@@ -82,28 +86,22 @@ namespace integer_encoding {
  * are intended to overrun given memory spaces
  * for performance reasons. A caller needs to make
  * sure that the overruning causes no crashes.
+ * Kernels are bound at startup, and see
+ * encoding_dispatch.hpp for details.
  */
 inline void MEMCPY(void *dest, void *src, uint64_t n) {
 	ASSERT(dest != NULL);
 	ASSERT(src != NULL);
 
-	char *s = reinterpret_cast<char *>(src);
-	char *d = reinterpret_cast<char *>(dest);
-
-	// num以128bit为单位，n以32bit为单位
-	uint64_t num = DIV_ROUNDUP(n, 4);
-	for (uint64_t i = 0; i < num; i++, s += 16, d += 16)
-		MEMCPY128(s, d);
+	// n以32bit为单位，实际以128bit为单位复制
+	internals::simdKernels->copy(reinterpret_cast<uint32_t *>(dest),
+			reinterpret_cast<const uint32_t *>(src), n);
 }
 
 inline void ZMEMCPY(void *dest, uint64_t n) {
 	ASSERT(dest != NULL);
 
-	char *d = reinterpret_cast<char *>(dest);
-
-	uint64_t num = DIV_ROUNDUP(n, 4);
-	for (uint64_t i = 0; i < num; i++, d += 16)
-		ZMEMCPY128(d);
+	internals::simdKernels->zero(reinterpret_cast<uint32_t *>(dest), n);
 }
 
 #define DISALLOW_COPY_AND_ASSIGN(__Type__)  \
@@ -111,7 +109,7 @@ inline void ZMEMCPY(void *dest, uint64_t n) {
     void operator= (const __Type__&)
 
 /* Num of coders */
-const int NUMCODERS = 20;
+const int NUMCODERS = 21;
 
 /* Encoder ID for policy */
 const int E_INVALID = -1;
@@ -135,6 +133,7 @@ const int E_VSEHYB = 16;
 const int E_VSESIMPLE = 17;
 const int E_KAFOR = 18;
 const int E_AFOR = 19;
+const int E_ADAPTIVE = 20;
 
 #define THROW_ENCODING_EXCEPTION(msg) \
     throw encoding_exception(msg, __FILE__, __func__, __LINE__)
@@ -30,12 +30,18 @@
 # define LZE_ARCH64
 #endif
 
-/* Byte-order detection */
-#if (defined(__BIG_ENDIAN__) || defined(__BIG_ENDIAN) ||  \
+/*
+ * Byte-order detection. glibc defines __BIG_ENDIAN on any cpu,
+ * so it is checked only if the compiler does not tell the order.
+ */
+#if defined(__BYTE_ORDER__)
+# if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#   define LZE_BIGENDIAN
+# endif
+#elif (defined(__BIG_ENDIAN__) || defined(__BIG_ENDIAN) ||  \
      defined(_BIG_ENDIAN) || defined(_ARCH_PPC) || defined(__PPC__) ||  \
      defined(__PPC) || defined(PPC) || defined(__powerpc__) ||          \
-     defined(__powerpc) || defined(powerpc) ||                          \
-     ((defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))))
+     defined(__powerpc) || defined(powerpc))
 # define LZE_BIGENDIAN
 #endif
 
@@ -45,9 +51,13 @@
 #if ((GCC_VERSION >= 302) || (__INTEL_COMPILER >= 800) || defined(__clang__))
 # define LIKELY(__x__)   __builtin_expect(!!(__x__), 1)
 # define UNLIKELY(__x__) __builtin_expect(!!(__x__), 0)
+# define FORCE_INLINE    inline __attribute__((always_inline))
+# define PREFETCH(__addr__) __builtin_prefetch((__addr__), 0, 3)
 #else
 # define LIKELY(__x__)
 # define UNLIKELY(__x__)
+# define FORCE_INLINE    inline
+# define PREFETCH(__addr__)
 #endif
 
 /* C99 standard option */
@@ -0,0 +1,85 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_prefetch.hpp - Software prefetching of lists and blocks
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_PREFETCH_HPP__
+#define __ENCODING_PREFETCH_HPP__
+
+#include <misc/encoding_port_internals.hpp>
+
+#include <cstdint>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * NOTE: Set this to "<lists>:<blocks>", e.g., "4:2", to change
+ * the distances below for benchmarks.
+ */
+#define PREFETCH_ENV  "INTEGER_ENCODING_PREFETCH"
+
+/* Cache lines that PrefetchBytes() touches at most */
+const uint64_t PREFETCH_LINE_SZ = 64;
+const uint64_t PREFETCH_MAX_LINES = 16;
+
+/*
+ * Distances of prefetching, and 0 turns each off. Both are 0 by
+ * default because hardware prefetchers follow sequential walks
+ * well once data are cached, so they are for cold files mostly.
+ *    lists  : # of lists ahead that callers walking lists, e.g.,
+ *             vcompress, prefetch while decoding a list
+ *    blocks : # of blocks ahead that block decoders prefetch, that
+ *             is, PForDelta blocks, KAFOR frames and chunks of
+ *             VSEncodingBlocks and ChunkedEncoding. Blocks ahead
+ *             are located by the size of the current one except
+ *             in ChunkedEncoding, so it is approximate for blocks
+ *             of variable sizes.
+ */
+struct PrefetchConfig {
+  uint32_t  lists;
+  uint32_t  blocks;
+
+  PrefetchConfig() : lists(0), blocks(0) {}
+};
+
+/* Parse "<lists>:<blocks>", and return false if it is invalid */
+bool ParsePrefetchConfig(const char *str, PrefetchConfig *conf);
+
+/* The config, which PREFETCH_ENV overrides first */
+const PrefetchConfig& GetPrefetchConfig();
+void SetPrefetchConfig(const PrefetchConfig& conf);
+
+/* Prefetch the head of [n] bytes up to PREFETCH_MAX_LINES */
+inline void PrefetchBytes(const void *addr, uint64_t n) {
+  const char *p = reinterpret_cast<const char *>(addr);
+  uint64_t lines = (n + PREFETCH_LINE_SZ - 1) / PREFETCH_LINE_SZ;
+
+  if (lines > PREFETCH_MAX_LINES)
+    lines = PREFETCH_MAX_LINES;
+  for (uint64_t i = 0; i < lines; i++)
+    PREFETCH(p + i * PREFETCH_LINE_SZ);
+}
+
+/*
+ * Ask the kernel to read pages of [n] bytes of a mapped file in
+ * advance. It costs a system call, so callers should advise a run
+ * of lists at once rather than each list.
+ */
+void AdviseWillNeed(const void *addr, uint64_t n);
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_PREFETCH_HPP__ */
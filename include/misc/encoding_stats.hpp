@@ -0,0 +1,87 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_stats.hpp - Statistics collected inside codecs
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_STATS_HPP__
+#define __ENCODING_STATS_HPP__
+
+#include <cstdint>
+#include <cstdio>
+
+namespace integer_encoding {
+namespace internals {
+
+/*
+ * Statistics that codecs record
+ *    AFOR_FRAMELEN   : # of integers in a frame decoded by AFOR
+ *    KAFOR_FRAMELEN  : # of integers in a frame decoded by KAFOR
+ *    VSEDP_LOOPS     : iterations of VSEncodingDP for a list
+ *    VSEOP_LOOPS     : iterations of optimal_partition for a list
+ *    VSE_PARTS       : # of blocks that VSEncodingDP cuts a list into
+ *    VSENAIVE_BLOCKLEN : # of integers in a block decoded by
+ *                      VSEncodingNaive
+ */
+const uint32_t STAT_AFOR_FRAMELEN = 0;
+const uint32_t STAT_KAFOR_FRAMELEN = 1;
+const uint32_t STAT_VSEDP_LOOPS = 2;
+const uint32_t STAT_VSEOP_LOOPS = 3;
+const uint32_t STAT_VSE_PARTS = 4;
+const uint32_t STAT_VSENAIVE_BLOCKLEN = 5;
+const uint32_t STAT_NUMS = 6;
+
+/* A histogram has a bucket for each bit width of values, 0 to 64 */
+const uint32_t STAT_NBUCKETS = 65;
+
+struct EncodingStat {
+  uint64_t  count;
+  uint64_t  sum;
+  uint64_t  max;
+  uint64_t  hist[STAT_NBUCKETS];
+};
+
+/*
+ * RecordEncodingStat
+ *   Add a value to a statistic. Each thread has its own
+ *   counters, so it takes no locks or atomic operations.
+ */
+void RecordEncodingStat(uint32_t id, uint64_t v);
+
+/* Sum the counters of all the threads */
+void GetEncodingStat(uint32_t id, EncodingStat *st);
+void ResetEncodingStats();
+
+/* Print statistics that have values to [fp] */
+void DumpEncodingStats(FILE *fp);
+
+const char *GetEncodingStatName(uint32_t id);
+
+/*
+ * NOTE: Codecs record statistics only if the library is built
+ * with -DINTEGER_ENCODING_STATS, and otherwise ENCODING_STAT()
+ * compiles to nothing.
+ */
+#ifdef INTEGER_ENCODING_STATS
+# define ENCODING_STATS_ENABLED  true
+# define ENCODING_STAT(__id__, __v__)  \
+    integer_encoding::internals::RecordEncodingStat(__id__, __v__)
+#else
+# define ENCODING_STATS_ENABLED  false
+# define ENCODING_STAT(__id__, __v__)  do {} while (0)
+#endif /* INTEGER_ENCODING_STATS */
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_STATS_HPP__ */
@@ -0,0 +1,121 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_threaded.hpp - A direct-threaded engine for frame decoders
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef __ENCODING_THREADED_HPP__
+#define __ENCODING_THREADED_HPP__
+
+#include <misc/encoding_internals.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+/* The max # of distinct frame headers */
+const uint32_t THREADED_MAX_HEADERS = 128;
+
+/*
+ * Repeat a macro for 0 to 127. Numbers are written in octal,
+ * e.g., 0017, so that they paste into label names.
+ */
+#define THREADED_R8(__m__, __p__)                           \
+  __m__(__p__##0) __m__(__p__##1) __m__(__p__##2)           \
+  __m__(__p__##3) __m__(__p__##4) __m__(__p__##5)           \
+  __m__(__p__##6) __m__(__p__##7)
+
+#define THREADED_R64(__m__, __p__)                          \
+  THREADED_R8(__m__, __p__##0) THREADED_R8(__m__, __p__##1) \
+  THREADED_R8(__m__, __p__##2) THREADED_R8(__m__, __p__##3) \
+  THREADED_R8(__m__, __p__##4) THREADED_R8(__m__, __p__##5) \
+  THREADED_R8(__m__, __p__##6) THREADED_R8(__m__, __p__##7)
+
+#define THREADED_R128(__m__)  \
+  THREADED_R64(__m__, 00) THREADED_R64(__m__, 01)
+
+/*
+ * ThreadedDecoder
+ *   Decode a sequence of frames by direct threading. A kernel for
+ *   each header is inlined after its own label, and it jumps to
+ *   the next kernel through a table of labels. So every kernel
+ *   has its own indirect jump, which predicts the next header from
+ *   the current one as VSEncodingSimple does. Ops needs
+ *     bool more()          : whether a next frame exists
+ *     uint32_t next()      : read the header of the next frame
+ *     void decode<H>()     : decode a frame with a header H
+ *
+ *   Ops is copied in a local variable while decoding, so that
+ *   its members stay in registers, and written back at the end.
+ *   decode<H>() should be FORCE_INLINE because the copy escapes
+ *   to memory once any kernel is left as a call. A header of N
+ *   or more throws an exception.
+ */
+template <typename Ops, uint32_t N>
+struct ThreadedDecoder {
+  static void run(Ops *ops);
+};
+
+template <typename Ops, uint32_t N>
+void ThreadedDecoder<Ops, N>::run(Ops *ops) {
+  static_assert(N > 0 && N <= THREADED_MAX_HEADERS,
+                "Out of range exception: N");
+
+#define THREADED_ADDR(__k__)  &&THREADED_L##__k__,
+  static const void *labels[THREADED_MAX_HEADERS] = {
+    THREADED_R128(THREADED_ADDR)
+  };
+#undef THREADED_ADDR
+
+  Ops o(*ops);
+  uint32_t h;
+
+#define THREADED_DISPATCH()           \
+  do {                                \
+    if (UNLIKELY(!o.more()))          \
+      goto THREADED_END;              \
+    h = o.next();                     \
+    if (UNLIKELY(h >= N))             \
+      goto THREADED_INVALID;          \
+    goto *labels[h];                  \
+  } while (0)
+
+  /* Labels of N or more go to THREADED_INVALID at compile time */
+#define THREADED_KERNEL(__k__)                                \
+  THREADED_L##__k__:                                          \
+    if (__k__ >= N)                                           \
+      goto THREADED_INVALID;                                  \
+    o.template decode<(__k__ < N)? __k__ : 0>();              \
+    THREADED_DISPATCH();
+
+  THREADED_DISPATCH();
+  THREADED_R128(THREADED_KERNEL)
+
+#undef THREADED_KERNEL
+#undef THREADED_DISPATCH
+
+THREADED_INVALID:
+  *ops = o;
+  THROW_ENCODING_EXCEPTION("Invalid value: header");
+
+THREADED_END:
+  *ops = o;
+}
+
+#undef THREADED_R128
+#undef THREADED_R64
+#undef THREADED_R8
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
+
+#endif /* __ENCODING_THREADED_HPP__ */
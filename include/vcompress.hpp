@@ -20,6 +20,12 @@
 #include <misc/encoding_internals.hpp>
 #include<unistd.h>
 
+#if defined(__linux__)
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+#endif
+
 namespace integer_encoding {
 
 /* Configurable parameters */
@@ -51,11 +57,16 @@ const uint32_t POS_EACH_ENTRY_SZ = 16;
     ({fprintf(stderr, __x__); fprintf(stderr, "\n"); exit(1);})
 /*
  * size指向的位置存储filename文件的大小(in Byte)
+ *
+ * With huge pages enabled, a file is read into a buffer on them
+ * instead of mapped, because file mappings get huge pages only on
+ * a few filesystems.
  */
 uint32_t *OpenFile(const std::string& filename, uint64_t *size) {
 	void *addr = NULL;
+	bool huge = false;
 
-	int fd = open(filename.c_str(), O_RDWR);
+	int fd = open(filename.c_str(), O_RDONLY);
 	if (fd == -1)
 		goto OPEN_EXCEPTION;
 
@@ -67,10 +78,23 @@ uint32_t *OpenFile(const std::string& filename, uint64_t *size) {
 
 	// 直接把文件*size大小的区域映射到用户空间上
 	// 不再经过文件->内核缓冲->用户空间的复制
-	addr = mmap(NULL, *size, PROT_READ | PROT_WRITE,
-	MAP_PRIVATE, fd, 0);
-	if (addr == MAP_FAILED)
-		goto OPEN_EXCEPTION;
+	// 解码器不再改写输入，所以只读映射即可，页面可在进程间共享
+	if (internals::IsHugePageEnabled()) {
+		addr = internals::AllocBuffer(*size, &huge);
+
+		/* Files are never closed until exit, so is the buffer */
+		for (uint64_t n = 0; n < *size;) {
+			ssize_t r = pread(fd, reinterpret_cast<char *>(addr) + n,
+					*size - n, n);
+			if (r <= 0 && !(r < 0 && errno == EINTR))
+				goto OPEN_EXCEPTION;
+			n += (r > 0)? r : 0;
+		}
+	} else {
+		addr = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+		if (addr == MAP_FAILED)
+			goto OPEN_EXCEPTION;
+	}
 
 	close(fd);
 	return reinterpret_cast<uint32_t *>(addr);
@@ -137,6 +161,77 @@ private:
 	DISALLOW_COPY_AND_ASSIGN(BenchmarkTimer);
 };
 
+/*
+ * Counters of dTLB loads and their misses in user space. They
+ * read -1 if the kernel or the cpu does not count them, e.g., in
+ * some VMs, and cpus that count only misses leave loads -1.
+ */
+class TlbCounter {
+public:
+	TlbCounter() : loads_(-1), misses_(-1) {}
+	~TlbCounter() throw () {
+		if (loads_ >= 0)
+			close(loads_);
+		if (misses_ >= 0)
+			close(misses_);
+	}
+
+	/* Counters are opened at first, so unused ones cost nothing */
+	void start() {
+		if (loads_ < 0 && misses_ < 0) {
+			loads_ = open_counter(PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+			misses_ = open_counter(PERF_COUNT_HW_CACHE_RESULT_MISS);
+		}
+		control(PERF_EVENT_IOC_RESET);
+		control(PERF_EVENT_IOC_ENABLE);
+	}
+
+	void stop() {
+		control(PERF_EVENT_IOC_DISABLE);
+	}
+
+	int64_t loads() const {
+		return read_counter(loads_);
+	}
+
+	int64_t misses() const {
+		return read_counter(misses_);
+	}
+
+private:
+	int loads_;
+	int misses_;
+
+	void control(unsigned long req) {
+		if (loads_ >= 0)
+			ioctl(loads_, req, 0);
+		if (misses_ >= 0)
+			ioctl(misses_, req, 0);
+	}
+
+	static int open_counter(uint64_t result) {
+		struct perf_event_attr attr;
+		memset(&attr, 0x00, sizeof(attr));
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.size = sizeof(attr);
+		attr.config = PERF_COUNT_HW_CACHE_DTLB |
+				(PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	}
+
+	static int64_t read_counter(int fd) {
+		uint64_t v;
+		if (fd < 0 || read(fd, &v, sizeof(v)) != sizeof(v))
+			return -1;
+		return static_cast<int64_t>(v);
+	}
+
+	DISALLOW_COPY_AND_ASSIGN(TlbCounter);
+};
+
 } /* namespace: integer_encoding */
 
 #endif /* __VCOMPRESS_HPP__ */
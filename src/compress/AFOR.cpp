@@ -24,6 +24,47 @@ void AFOR::decodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
 	if (len != decode<uint32_t>(out, (char*) in, nvalue))
 		throw "len of in unequals to length actually used!";
 }
+void AFOR::appendArray(const uint32_t *in, uint64_t len, uint64_t num,
+		const uint32_t *add, uint64_t addlen, uint32_t *out,
+		uint64_t *nvalue) const {
+	if (add == NULL || addlen == 0)
+		THROW_ENCODING_EXCEPTION("Invalid input: add");
+	if (num == 0) {
+		encodeArray(add, addlen, out, nvalue);
+		return;
+	}
+
+	// skip frames of full windows by their headers
+	const char *src = (const char*) in;
+	const char *sterm = src + len;
+	uint32_t full = num / windowLength() * windowLength();
+	uint32_t skipped = 0;
+	while (skipped < full) {
+		if (UNLIKELY(src >= sterm))
+			THROW_ENCODING_EXCEPTION("Invalid input: in");
+		uint32_t frameHeader = *(const uint8_t*) src;
+		uint32_t frameLength = 8 << (frameHeader >> 5);
+		uint32_t bitWidth = (frameHeader & 31) + 1;
+		src += 1 + ((bitWidth * frameLength) >> 3);
+		skipped += frameLength;
+	}
+	if (UNLIKELY(skipped != full || src > sterm))
+		THROW_ENCODING_EXCEPTION("Invalid input: in");
+
+	// re-encode the last window and VarByte with [add]
+	uint64_t ntail = num - full;
+	REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(ntail + addlen));
+	if (ntail != 0)
+		decode<uint32_t>(list, src, ntail);
+	memcpy(list + ntail, add, addlen * sizeof(uint32_t));
+
+	uint64_t nhead = src - (const char*) in;
+	uint64_t csize = *nvalue;
+	encodeArray(list, ntail + addlen, (uint32_t*) ((char*) out + nhead),
+			&csize);
+	memcpy(out, in, nhead);
+	*nvalue = nhead + csize;
+}
 uint64_t AFOR::require(uint64_t len) const {
 	return len;
 }
@@ -0,0 +1,193 @@
+/*-----------------------------------------------------------------------------
+ *  AdaptiveBlocks.cpp - A meta-codec to select a codec for each block
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <compress/policy/AdaptiveBlocks.hpp>
+
+#include <algorithm>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+const uint32_t ADAPTIVE_LOGSIZE = 14;
+const uint32_t ADAPTIVE_MAX_SIZE = (1U << ADAPTIVE_LOGSIZE) - 1;
+
+inline uint64_t SelectorLength(uint64_t nblocks) {
+  return DIV_ROUNDUP(nblocks, 2);
+}
+
+/* Words that any codec writes at most for a block of len */
+inline uint64_t ScratchLength(uint64_t len) {
+  return 4 * len + 128;
+}
+
+} /* namespace: */
+
+AdaptiveBlocks::AdaptiveBlocks(uint32_t blocksz, double slack)
+    : EncodingBase(E_ADAPTIVE), blocksz_(blocksz), slack_(slack) {
+  if (blocksz == 0 || blocksz > ADAPTIVE_MAX_BLOCKSZ)
+    THROW_ENCODING_EXCEPTION("Out of range exception: blocksz");
+  if (slack < 0.0)
+    THROW_ENCODING_EXCEPTION("Invalid value: slack");
+
+  codecs_[ADAPTIVE_VSESIMPLE] = EncodingPtr(new VSEncodingSimple());
+  codecs_[ADAPTIVE_P4D] = EncodingPtr(new PForDelta());
+  codecs_[ADAPTIVE_SIMPLE16] = EncodingPtr(new Simple16());
+  codecs_[ADAPTIVE_VBYTE] = EncodingPtr(new VariableByte());
+}
+
+AdaptiveBlocks::~AdaptiveBlocks() throw() {}
+
+void AdaptiveBlocks::encodeArray(const uint32_t *in,
+                                 uint64_t len,
+                                 uint32_t *out,
+                                 uint64_t *nvalue) const {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (len == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: len");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+  if (*nvalue == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+  ASSERT_ADDR(in, len);
+  ASSERT_ADDR(out, *nvalue);
+
+  uint64_t nblocks = DIV_ROUNDUP(len, blocksz_);
+  uint64_t hlen = 1 + SelectorLength(nblocks);
+  if (*nvalue <= hlen)
+    THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+  BYTEORDER_FREE_STORE32(out, blocksz_);
+
+  uint32_t *sels = out + 1;
+  uint32_t *data = out + hlen;
+  uint64_t pos = 0;
+
+  /* Each codec tries a block in its own scratch */
+  std::vector<uint32_t> scratch[ADAPTIVE_NCODECS];
+  for (uint32_t c = 0; c < ADAPTIVE_NCODECS; c++)
+    scratch[c].resize(ScratchLength(blocksz_));
+
+  for (uint64_t i = 0; i < nblocks; i++) {
+    uint64_t blen = std::min(len - i * blocksz_, uint64_t(blocksz_));
+
+    uint64_t csize[ADAPTIVE_NCODECS];
+    uint64_t minsize = UINT64_MAX;
+
+    for (uint32_t c = 0; c < ADAPTIVE_NCODECS; c++) {
+      csize[c] = scratch[c].size();
+      try {
+        codecs_[c]->encodeArray(in + i * blocksz_, blen,
+                                scratch[c].data(), &csize[c]);
+      } catch (const encoding_exception&) {
+        /* e.g., Simple16 cannot encode integers over 28 bits */
+        csize[c] = UINT64_MAX;
+        continue;
+      }
+
+      minsize = std::min(minsize, csize[c]);
+    }
+
+    /* Take the fastest codec within a budget */
+    uint32_t sel = 0;
+    while (csize[sel] > minsize * (1.0 + slack_))
+      sel++;
+
+    if (csize[sel] > ADAPTIVE_MAX_SIZE)
+      THROW_ENCODING_EXCEPTION("Out of range exception: csize");
+
+    if (pos + csize[sel] > *nvalue - hlen)
+      THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+    std::copy(scratch[sel].begin(), scratch[sel].begin() + csize[sel],
+              data + pos);
+    pos += csize[sel];
+
+    /* Pack a selector into the upper or lower half of a word */
+    uint32_t s = (sel << ADAPTIVE_LOGSIZE) | csize[sel];
+    uint32_t w = (i % 2 == 0)? s << 16 :
+        BYTEORDER_FREE_LOAD32(sels + i / 2) | s;
+    BYTEORDER_FREE_STORE32(sels + i / 2, w);
+  }
+
+  *nvalue = hlen + pos;
+}
+
+void AdaptiveBlocks::decodeArray(const uint32_t *in,
+                                 uint64_t len,
+                                 uint32_t *out,
+                                 uint64_t nvalue) const {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (len == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: len");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+  if (nvalue == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+  ASSERT_ADDR(in, len);
+  ASSERT_ADDR(out, nvalue);
+
+  uint32_t blocksz = BYTEORDER_FREE_LOAD32(in);
+  if (blocksz == 0 || blocksz > ADAPTIVE_MAX_BLOCKSZ)
+    THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+  uint64_t nblocks = DIV_ROUNDUP(nvalue, blocksz);
+  uint64_t hlen = 1 + SelectorLength(nblocks);
+  if (len < hlen)
+    THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+  const uint32_t *sels = in + 1;
+  const uint32_t *data = in + hlen;
+  const uint32_t *iterm = in + len;
+
+  /*
+   * Blocks are decoded in order, so a codec overrunning the
+   * tail of its block is fixed by the next one.
+   */
+  for (uint64_t i = 0; i < nblocks; i++) {
+    uint32_t w = BYTEORDER_FREE_LOAD32(sels + i / 2);
+    uint32_t s = (i % 2 == 0)? w >> 16 : w & 0xffff;
+    uint32_t csize = s & ADAPTIVE_MAX_SIZE;
+    uint32_t sel = s >> ADAPTIVE_LOGSIZE;
+
+    if (sel >= ADAPTIVE_NCODECS || data + csize > iterm)
+      THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+    uint64_t blen = std::min(nvalue - i * blocksz, uint64_t(blocksz));
+    codecs_[sel]->decodeArray(data, csize, out + i * blocksz, blen);
+    data += csize;
+  }
+}
+
+uint64_t AdaptiveBlocks::require(uint64_t len) const {
+  /*
+   * VariableByte needs 40-bit for an integer at most, and a block
+   * can take up to (1 + slack) times the smallest size.
+   */
+  uint64_t nblocks = (len != 0)? DIV_ROUNDUP(len, blocksz_) : 1;
+  uint64_t vbyte = DIV_ROUNDUP(40 * len, 32) + nblocks;
+
+  return 1 + SelectorLength(nblocks) +
+      static_cast<uint64_t>(vbyte * (1.0 + slack_)) + nblocks;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
@@ -0,0 +1,259 @@
+/*-----------------------------------------------------------------------------
+ *  ChunkedEncoding.cpp - A wrapper to split a list into independent chunks
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <compress/ChunkedEncoding.hpp>
+
+#include <algorithm>
+#include <omp.h>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+/* [chunk len][# of chunks] before offsets */
+const uint64_t CHUNKED_HEADER_LEN = 2;
+
+inline uint64_t DirectoryLength(uint64_t nchunks) {
+  return CHUNKED_HEADER_LEN + nchunks + 1;
+}
+
+} /* namespace: */
+
+ChunkedEncoding::ChunkedEncoding(EncodingPtr codec, uint32_t chunk)
+    : EncodingBase(E_INVALID), codec_(codec), chunk_(chunk) {
+  if (codec == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: codec");
+  if (chunk < CHUNKED_MIN_LEN)
+    THROW_ENCODING_EXCEPTION("Invalid value: chunk");
+}
+
+ChunkedEncoding::~ChunkedEncoding() throw() {}
+
+void ChunkedEncoding::encodeArray(const uint32_t *in,
+                                  uint64_t len,
+                                  uint32_t *out,
+                                  uint64_t *nvalue) const {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (len == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: len");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+  if (*nvalue == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+  ASSERT_ADDR(in, len);
+  ASSERT_ADDR(out, *nvalue);
+
+  uint64_t nchunks = DIV_ROUNDUP(len, chunk_);
+  if (nchunks > UINT32_MAX)
+    THROW_ENCODING_EXCEPTION("Out of range exception: len");
+
+  uint64_t hlen = DirectoryLength(nchunks);
+  if (*nvalue <= hlen)
+    THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+  BYTEORDER_FREE_STORE32(out, chunk_);
+  BYTEORDER_FREE_STORE32(out + 1, static_cast<uint32_t>(nchunks));
+
+  uint32_t *offs = out + CHUNKED_HEADER_LEN;
+  uint32_t *data = out + hlen;
+  uint64_t pos = 0;
+
+  BYTEORDER_FREE_STORE32(offs, 0);
+
+  for (uint64_t i = 0; i < nchunks; i++) {
+    uint64_t clen = std::min(len - i * chunk_, uint64_t(chunk_));
+    uint64_t csize = *nvalue - hlen - pos;
+
+    if (csize == 0)
+      THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+    codec_->encodeArray(in + i * chunk_, clen, data + pos, &csize);
+    pos += csize;
+
+    if (pos > UINT32_MAX)
+      THROW_ENCODING_EXCEPTION("Out of range exception: offsets");
+
+    BYTEORDER_FREE_STORE32(offs + i + 1, static_cast<uint32_t>(pos));
+  }
+
+  *nvalue = hlen + pos;
+}
+
+void ChunkedEncoding::decodeChunks(const uint32_t *in,
+                                   uint64_t len,
+                                   uint32_t *out,
+                                   uint64_t nvalue,
+                                   int nthreads,
+                                   std::vector<uint32_t> *sums) const {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (len <= CHUNKED_HEADER_LEN)
+    THROW_ENCODING_EXCEPTION("Invalid input: len");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+  if (nvalue == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+  ASSERT_ADDR(in, len);
+  ASSERT_ADDR(out, nvalue);
+
+  uint32_t chunk = BYTEORDER_FREE_LOAD32(in);
+  int64_t nchunks = BYTEORDER_FREE_LOAD32(in + 1);
+
+  if (chunk < CHUNKED_MIN_LEN ||
+      static_cast<uint64_t>(nchunks) != DIV_ROUNDUP(nvalue, chunk) ||
+      len < DirectoryLength(nchunks))
+    THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+  const uint32_t *offs = in + CHUNKED_HEADER_LEN;
+  const uint32_t *data = in + DirectoryLength(nchunks);
+  uint64_t dlen = len - DirectoryLength(nchunks);
+
+  if (sums != NULL)
+    sums->resize(nchunks);
+
+  if (nthreads <= 0)
+    nthreads = omp_get_max_threads();
+  if (nthreads > nchunks)
+    nthreads = nchunks;
+
+  std::exception_ptr err;
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    /*
+     * Each thread decodes a range of chunks in order, so a chunk
+     * overrunning its tail is fixed by the next one. Only the last
+     * chunk of a range goes through a scratch because it could
+     * break a chunk that the next thread has decoded.
+     */
+    int64_t nt = omp_get_num_threads();
+    int64_t t = omp_get_thread_num();
+    int64_t beg = nchunks * t / nt;
+    int64_t end = nchunks * (t + 1) / nt;
+
+    std::vector<uint32_t> scratch;
+    const int64_t dist = GetPrefetchConfig().blocks;
+
+    for (int64_t i = beg; i < end; i++) {
+      try {
+        uint32_t off = BYTEORDER_FREE_LOAD32(offs + i);
+        uint32_t next = BYTEORDER_FREE_LOAD32(offs + i + 1);
+
+        if (next < off || next > dlen)
+          THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+        /* The directory tells where chunks ahead start */
+        if (dist != 0 && i + dist < end) {
+          uint32_t ahead = BYTEORDER_FREE_LOAD32(offs + i + dist);
+          uint32_t atail = BYTEORDER_FREE_LOAD32(offs + i + dist + 1);
+          if (ahead < atail && atail <= dlen)
+            PrefetchBytes(data + ahead, uint64_t(atail - ahead) * 4);
+        }
+
+        uint32_t *dst = out + i * chunk;
+        uint64_t clen = std::min(nvalue - i * chunk, uint64_t(chunk));
+
+        if (i + 1 == end && i + 1 != nchunks) {
+          scratch.resize(DECODE_REQUIRE_MEM(clen));
+          codec_->decodeArray(data + off, next - off,
+                              scratch.data(), clen);
+          std::copy(scratch.begin(), scratch.begin() + clen, dst);
+        } else {
+          codec_->decodeArray(data + off, next - off, dst, clen);
+        }
+
+        /* Sum d-gaps while the chunk is hot in caches */
+        if (sums != NULL) {
+          uint32_t s = clen;
+          for (uint64_t j = 0; j < clen; j++)
+            s += dst[j];
+          (*sums)[i] = s;
+        }
+      } catch (...) {
+#pragma omp critical
+        if (!err)
+          err = std::current_exception();
+      }
+    }
+  }
+
+  if (err)
+    std::rethrow_exception(err);
+}
+
+void ChunkedEncoding::decodeArray(const uint32_t *in,
+                                  uint64_t len,
+                                  uint32_t *out,
+                                  uint64_t nvalue) const {
+  decodeChunks(in, len, out, nvalue, 1, NULL);
+}
+
+void ChunkedEncoding::decodeParallel(const uint32_t *in,
+                                     uint64_t len,
+                                     uint32_t *out,
+                                     uint64_t nvalue,
+                                     int nthreads) const {
+  decodeChunks(in, len, out, nvalue, nthreads, NULL);
+}
+
+void ChunkedEncoding::decodeSortedParallel(const uint32_t *in,
+                                           uint64_t len,
+                                           uint32_t *out,
+                                           uint64_t nvalue,
+                                           uint32_t prev,
+                                           int nthreads) const {
+  /* 1st pass: decode chunks and sum each of them */
+  std::vector<uint32_t> sums;
+  decodeChunks(in, len, out, nvalue, nthreads, &sums);
+
+  int64_t nchunks = sums.size();
+  uint32_t chunk = BYTEORDER_FREE_LOAD32(in);
+
+  /* Turn the sums into the values just before chunks */
+  for (int64_t i = 0; i < nchunks; i++) {
+    uint32_t s = sums[i];
+    sums[i] = prev;
+    prev += s;
+  }
+
+  if (nthreads <= 0)
+    nthreads = omp_get_max_threads();
+
+  /* 2nd pass: restore each chunk from the value before it */
+  const SimdKernels& k = GetSimdKernels();
+
+#pragma omp parallel for num_threads(nthreads)
+  for (int64_t i = 0; i < nchunks; i++) {
+    uint64_t clen = std::min(nvalue - i * chunk, uint64_t(chunk));
+    k.dgap(out + i * chunk, clen, sums[i]);
+  }
+}
+
+uint64_t ChunkedEncoding::require(uint64_t len) const {
+  uint64_t nchunks = (len != 0)? DIV_ROUNDUP(len, chunk_) : 1;
+  uint64_t last = len - (nchunks - 1) * chunk_;
+
+  return DirectoryLength(nchunks) +
+      (nchunks - 1) * codec_->require(chunk_) +
+      codec_->require(last);
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
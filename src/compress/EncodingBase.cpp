@@ -0,0 +1,51 @@
+/*-----------------------------------------------------------------------------
+ *  EncodingBase.cpp - A base class for a series of decoders/encoders
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_internals.hpp>
+
+#include <compress/EncodingBase.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+void EncodingBase::appendArray(const uint32_t *in,
+                               uint64_t len,
+                               uint64_t num,
+                               const uint32_t *add,
+                               uint64_t addlen,
+                               uint32_t *out,
+                               uint64_t *nvalue) const {
+  if (in == NULL && num != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (add == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: add");
+  if (addlen == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: addlen");
+
+  if (num == 0) {
+    encodeArray(add, addlen, out, nvalue);
+    return;
+  }
+
+  REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(num + addlen));
+
+  decodeArray(in, len, list, num);
+  memcpy(list + num, add, addlen * sizeof(uint32_t));
+  encodeArray(list, num + addlen, out, nvalue);
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
@@ -0,0 +1,50 @@
+/**
+ * filename:GAFOR.cpp
+ * @brief:
+ * @data:2026-10-18
+ */
+#include <compress/policy/AFOR/GAFOR.hpp>
+using namespace integer_encoding::internals;
+GAFOR::GAFOR(uint32_t windowSize, uint32_t minFrame, uint32_t maxFrame) :
+		AFOR(), m_units(windowSize >> 3), m_minLog(0), m_maxLog(0) {
+	if (windowSize == 0 || windowSize % 8 != 0
+			|| windowSize > GAFOR_MAX_WINDOWSZ)
+		THROW_ENCODING_EXCEPTION("Out of range exception: windowSize");
+	if (minFrame > maxFrame)
+		THROW_ENCODING_EXCEPTION("Invalid value: minFrame");
+
+	// frame headers only have 8, 16 and 32
+	for (uint32_t k = 0; k < 3; ++k) {
+		if (minFrame == (8U << k))
+			m_minLog = k + 1;
+		if (maxFrame == (8U << k))
+			m_maxLog = k + 1;
+	}
+	if (m_minLog == 0)
+		THROW_ENCODING_EXCEPTION("Invalid value: minFrame");
+	if (m_maxLog == 0)
+		THROW_ENCODING_EXCEPTION("Invalid value: maxFrame");
+	m_minLog--;
+	m_maxLog--;
+}
+GAFOR::~GAFOR() throw () {
+
+}
+void GAFOR::encodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
+		uint64_t *nvalue) const {
+	*nvalue = encode<uint32_t>((char*) out, in, len);
+}
+int GAFOR::encodeUint32(char* des, const uint32_t* src, uint32_t encodeNum) {
+	return encode<uint32_t>(des, src, encodeNum);
+}
+int GAFOR::encodeUint16(char* des, const uint16_t* src, uint32_t encodeNum) {
+	return encode<uint16_t>(des, src, encodeNum);
+}
+int GAFOR::encodeUint8(char* des, const uint8_t* src, uint32_t encodeNum) {
+	return encode<uint8_t>(des, src, encodeNum);
+}
+
+Compressor* GAFOR::clone() {
+	Compressor* pNewComp = new GAFOR(*this);
+	return pNewComp;
+}
@@ -25,6 +25,73 @@ void KAFOR::decodeArray(const uint32_t *in, uint64_t len, uint32_t *out,
 	if (len != decode<uint32_t>(out, (char*) in, nvalue))
 		throw "len of in unequals to length actually used!";
 }
+void KAFOR::appendArray(const uint32_t *in, uint64_t len, uint64_t num,
+		const uint32_t *add, uint64_t addlen, uint32_t *out,
+		uint64_t *nvalue) const {
+	// lists without a block are only of VarByte
+	if (num < m_windowSize) {
+		EncodingBase::appendArray(in, len, num, add, addlen, out, nvalue);
+		return;
+	}
+	if (add == NULL || addlen == 0)
+		THROW_ENCODING_EXCEPTION("Invalid input: add");
+
+	// walk the frame headers for the end of data and its offset
+	const char *src = (const char*) in;
+	uint32_t dataSegOffset = *(const uint32_t*) src;
+	if (UNLIKELY(dataSegOffset < 4 || dataSegOffset > len))
+		THROW_ENCODING_EXCEPTION("Invalid input: in");
+	uint32_t numFrames = dataSegOffset - 4;
+	uint32_t aligned = num / m_windowSize * m_windowSize;
+	uint64_t words = 0;
+	uint32_t byteOffset = 0;
+	uint64_t decoded = 0;
+	for (uint32_t i = 0; i < numFrames; ++i) {
+		uint8_t frameHeader = (uint8_t) src[4 + i];
+		const KAFORUnpackInfo &info = KAFORUnpackInfoArr[
+				(((uint32_t) frameHeader) << 2) + byteOffset];
+		words += info.m_wordSkipped;
+		byteOffset = info.m_newOffset >> 3;
+		decoded += info.m_intDecoded;
+	}
+	uint64_t blockByte = dataSegOffset + words * 4 + ((byteOffset > 0) ? 16 : 0);
+	if (UNLIKELY(decoded != aligned || blockByte > len))
+		THROW_ENCODING_EXCEPTION("Invalid input: in");
+
+	uint64_t ntail = num - aligned;
+	uint64_t nlist = ntail + addlen;
+	REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(nlist));
+	if (ntail != 0)
+		VarByte::decode<uint32_t>(list, src + blockByte, ntail);
+	memcpy(list + ntail, add, addlen * sizeof(uint32_t));
+
+	char *des = (char*) out;
+	uint32_t more = nlist / m_windowSize * m_windowSize;
+	if (more == 0) {
+		memcpy(des, src, blockByte);
+		*nvalue = blockByte + VarByte::encode(des + blockByte, list, nlist);
+		return;
+	}
+
+	// choose headers of new frames as they are encoded alone
+	REGISTER_VECTOR_RAII(uint32_t, tmp, DECODE_REQUIRE_MEM(2 * more));
+	encodeBlock((char*) tmp, list, more);
+	uint32_t numNewFrames = *tmp - 4;
+
+	*(uint32_t*) des = dataSegOffset + numNewFrames;
+	memcpy(des + 4, src + 4, numFrames);
+	memcpy(des + dataSegOffset, (char*) tmp + 4, numNewFrames);
+
+	// new frames fill the last row of old ones first
+	char *data = des + dataSegOffset + numNewFrames;
+	memcpy(data, src + dataSegOffset, blockByte - dataSegOffset);
+	data += words * 4;
+	data += encodeAllFrames(data, list, des + dataSegOffset, numNewFrames,
+			byteOffset);
+	data += VarByte::encode(data, list + more, nlist - more);
+
+	*nvalue = data - des;
+}
 uint64_t KAFOR::require(uint64_t len) const {
 	return len;
 }
@@ -0,0 +1,411 @@
+/**
+ * filename:KAFOR_simd.cpp
+ * @brief: scalar/SSE/AVX2 kernels for KAFOR frames, see KAFOR_simd.hpp
+ *         Every kernel is generated from templates over
+ *         (frame length, bit width, bit offset), and all slots of a
+ *         frame are unrolled at compile time, so shift counts are
+ *         immediates and spills between word groups need no branches.
+ * @data:2013-12-02
+ * @author:zxd
+ */
+
+#include <cstring>
+
+#include <misc/encoding_dispatch.hpp>
+#include <compress/policy/AFOR/KAFOR_simd.hpp>
+
+#if defined(__x86_64__) || defined(__x86_64)
+# define KAFOR_ENABLE_SIMD
+# include <immintrin.h>
+#endif
+
+namespace integer_encoding {
+namespace internals {
+
+#define KAFOR_MASK(__b__) \
+    (((__b__) < 32)? (1U << ((__b__) & 31)) - 1 : 0xffffffffU)
+
+namespace {
+
+/*
+ * Scalar variants of the slots below, which take the four
+ * lanes of a word group one by one. A slot that starts a
+ * word overwrites it, and the others are or'ed into it.
+ */
+template<uint32_t B, uint32_t OFF, uint32_t I, uint32_t L>
+struct KAFORSlot {
+	static const uint32_t BIT = OFF + I * B;
+	static const uint32_t WORD = (BIT >> 5) << 2;
+	static const uint32_t SHIFT = BIT & 31;
+	static const bool SPILL = (SHIFT + B > 32);
+
+	static inline void unpack(uint32_t *des, const uint32_t *src) {
+		for (uint32_t j = 0; j < 4; j++) {
+			uint32_t v = src[WORD + j] >> SHIFT;
+			if (SPILL)
+				v |= src[WORD + 4 + j] << ((32 - SHIFT) & 31);
+			des[(I << 2) + j] = v & KAFOR_MASK(B);
+		}
+
+		KAFORSlot<B, OFF, I + 1, L>::unpack(des, src);
+	}
+
+	static inline void pack(uint32_t *des, const uint32_t *src) {
+		for (uint32_t j = 0; j < 4; j++) {
+			uint32_t v = src[(I << 2) + j] & KAFOR_MASK(B);
+			if (SHIFT == 0)
+				des[WORD + j] = v;
+			else
+				des[WORD + j] |= v << SHIFT;
+			if (SPILL)
+				des[WORD + 4 + j] = v >> ((32 - SHIFT) & 31);
+		}
+
+		KAFORSlot<B, OFF, I + 1, L>::pack(des, src);
+	}
+};
+
+template<uint32_t B, uint32_t OFF, uint32_t L>
+struct KAFORSlot<B, OFF, L, L> {
+	static inline void unpack(uint32_t *des, const uint32_t *src) {
+	}
+
+	static inline void pack(uint32_t *des, const uint32_t *src) {
+	}
+};
+
+/*
+ * A frame of the IDX-th entry in KAFORPackInfoArr/KAFORUnpackInfoArr:
+ * IDX = ((frameLengthId + bitWidth - 1) << 2) + (offset >> 3)
+ */
+template<uint32_t IDX>
+struct KAFORFrame {
+	static const uint32_t L = 8U << (IDX >> 7);
+	static const uint32_t B = ((IDX >> 2) & 31) + 1;
+	static const uint32_t OFF = (IDX & 3) << 3;
+	static const uint32_t END = OFF + L * B;
+
+	static void unpack(uint32_t *des, const uint32_t *src) {
+		KAFORSlot<B, OFF, 0, L>::unpack(des, src);
+	}
+
+	static void pack(uint32_t *des, const uint32_t *src) {
+		KAFORSlot<B, OFF, 0, L>::pack(des, src);
+	}
+};
+
+} /* namespace: */
+
+#define KAFOR_UNPACK_INFO(__i__) { KAFORFrame<__i__>::unpack, \
+    KAFORFrame<__i__>::OFF, KAFORFrame<__i__>::END & 31, \
+    (KAFORFrame<__i__>::END >> 5) << 2, KAFORFrame<__i__>::L << 2 }
+#define KAFOR_PACK_INFO(__i__) { KAFORFrame<__i__>::pack, \
+    KAFORFrame<__i__>::OFF, KAFORFrame<__i__>::END & 31, \
+    (KAFORFrame<__i__>::END >> 5) << 2, KAFORFrame<__i__>::L << 2 }
+
+#define KAFOR_INFO4(__m__, __i__) \
+    __m__(__i__), __m__(__i__ + 1), __m__(__i__ + 2), __m__(__i__ + 3)
+#define KAFOR_INFO16(__m__, __i__) \
+    KAFOR_INFO4(__m__, __i__), KAFOR_INFO4(__m__, __i__ + 4), \
+    KAFOR_INFO4(__m__, __i__ + 8), KAFOR_INFO4(__m__, __i__ + 12)
+#define KAFOR_INFO128(__m__, __i__) \
+    KAFOR_INFO16(__m__, __i__), KAFOR_INFO16(__m__, __i__ + 16), \
+    KAFOR_INFO16(__m__, __i__ + 32), KAFOR_INFO16(__m__, __i__ + 48), \
+    KAFOR_INFO16(__m__, __i__ + 64), KAFOR_INFO16(__m__, __i__ + 80), \
+    KAFOR_INFO16(__m__, __i__ + 96), KAFOR_INFO16(__m__, __i__ + 112)
+
+const KAFORUnpackInfo KAFORUnpackInfoArr[KAFOR_NUM_KERNELS] = {
+	KAFOR_INFO128(KAFOR_UNPACK_INFO, 0),
+	KAFOR_INFO128(KAFOR_UNPACK_INFO, 128),
+	KAFOR_INFO128(KAFOR_UNPACK_INFO, 256)
+};
+
+const KAFORPackInfo KAFORPackInfoArr[KAFOR_NUM_KERNELS] = {
+	KAFOR_INFO128(KAFOR_PACK_INFO, 0),
+	KAFOR_INFO128(KAFOR_PACK_INFO, 128),
+	KAFOR_INFO128(KAFOR_PACK_INFO, 256)
+};
+
+#ifdef KAFOR_ENABLE_SIMD
+
+#define KAFOR_LOAD128(__addr__) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i *>(__addr__))
+#define KAFOR_STORE128(__addr__, __v__) \
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(__addr__), __v__)
+
+#define KAFOR_AVX2  __attribute__((target("avx2")))
+
+namespace {
+
+/*
+ * Slot I of a L-slot frame with bit width B, which starts at
+ * bit OFF in the first word group. A word group is four 32-bit
+ * words, and each slot occupies B bits of all the four lanes.
+ */
+template<uint32_t B, uint32_t OFF, uint32_t I, uint32_t L>
+struct KAFORSlotSSE {
+	static const uint32_t BIT = OFF + I * B;
+	static const uint32_t WORD = (BIT >> 5) << 2;
+	static const uint32_t SHIFT = BIT & 31;
+	static const bool SPILL = (SHIFT + B > 32);
+
+	static inline void unpack(uint32_t *des, const uint32_t *src,
+			__m128i mask) {
+		__m128i v = _mm_srli_epi32(KAFOR_LOAD128(src + WORD), SHIFT);
+		if (SPILL)
+			v = _mm_or_si128(v,
+					_mm_slli_epi32(KAFOR_LOAD128(src + WORD + 4), 32 - SHIFT));
+		if (B < 32)
+			v = _mm_and_si128(v, mask);
+		KAFOR_STORE128(des + (I << 2), v);
+
+		KAFORSlotSSE<B, OFF, I + 1, L>::unpack(des, src, mask);
+	}
+
+	static inline void pack(uint32_t *des, const uint32_t *src, __m128i mask,
+			__m128i acc) {
+		__m128i v = KAFOR_LOAD128(src + (I << 2));
+		if (B < 32)
+			v = _mm_and_si128(v, mask);
+		acc = _mm_or_si128(acc, _mm_slli_epi32(v, SHIFT));
+		if (SHIFT + B >= 32) {
+			KAFOR_STORE128(des + WORD, acc);
+			acc = (SPILL) ? _mm_srli_epi32(v, 32 - SHIFT) : _mm_setzero_si128();
+		}
+
+		KAFORSlotSSE<B, OFF, I + 1, L>::pack(des, src, mask, acc);
+	}
+};
+
+template<uint32_t B, uint32_t OFF, uint32_t L>
+struct KAFORSlotSSE<B, OFF, L, L> {
+	static const uint32_t BIT = OFF + L * B;
+
+	static inline void unpack(uint32_t *des, const uint32_t *src,
+			__m128i mask) {
+	}
+
+	/* Write back a partially filled word group */
+	static inline void pack(uint32_t *des, const uint32_t *src, __m128i mask,
+			__m128i acc) {
+		if (BIT & 31)
+			KAFOR_STORE128(des + ((BIT >> 5) << 2), acc);
+	}
+};
+
+/*
+ * AVX2 variants process slots I and I+1 at once; the two
+ * word groups are loaded into the two 128-bit halves and
+ * shifted with per-lane shift counts. A shift count of 32
+ * clears a lane, which makes non-spilled halves vanish.
+ */
+template<uint32_t B, uint32_t OFF, uint32_t I, uint32_t L>
+struct KAFORSlotAVX2 {
+	static const uint32_t BIT0 = OFF + I * B;
+	static const uint32_t BIT1 = BIT0 + B;
+	static const uint32_t WORD0 = (BIT0 >> 5) << 2;
+	static const uint32_t WORD1 = (BIT1 >> 5) << 2;
+	static const uint32_t SHIFT0 = BIT0 & 31;
+	static const uint32_t SHIFT1 = BIT1 & 31;
+	static const bool SPILL0 = (SHIFT0 + B > 32);
+	static const bool SPILL1 = (SHIFT1 + B > 32);
+	static const uint32_t RSHIFT0 = (SPILL0) ? 32 - SHIFT0 : 32;
+	static const uint32_t RSHIFT1 = (SPILL1) ? 32 - SHIFT1 : 32;
+
+	KAFOR_AVX2 static inline void unpack(uint32_t *des, const uint32_t *src,
+			__m256i mask) {
+		__m256i w = _mm256_inserti128_si256(
+				_mm256_castsi128_si256(KAFOR_LOAD128(src + WORD0)),
+				KAFOR_LOAD128(src + WORD1), 1);
+		__m256i v = _mm256_srlv_epi32(w,
+				_mm256_setr_epi32(SHIFT0, SHIFT0, SHIFT0, SHIFT0, SHIFT1, SHIFT1,
+						SHIFT1, SHIFT1));
+		if (SPILL0 || SPILL1) {
+			__m128i h0 =
+					(SPILL0) ? KAFOR_LOAD128(src + WORD0 + 4) : _mm_setzero_si128();
+			__m128i h1 =
+					(SPILL1) ? KAFOR_LOAD128(src + WORD1 + 4) : _mm_setzero_si128();
+			__m256i h = _mm256_inserti128_si256(_mm256_castsi128_si256(h0), h1,
+					1);
+			v = _mm256_or_si256(v,
+					_mm256_sllv_epi32(h,
+							_mm256_setr_epi32(RSHIFT0, RSHIFT0, RSHIFT0, RSHIFT0,
+									RSHIFT1, RSHIFT1, RSHIFT1, RSHIFT1)));
+		}
+		if (B < 32)
+			v = _mm256_and_si256(v, mask);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(des + (I << 2)), v);
+
+		KAFORSlotAVX2<B, OFF, I + 2, L>::unpack(des, src, mask);
+	}
+
+	KAFOR_AVX2 static inline void pack(uint32_t *des, const uint32_t *src,
+			__m256i mask, __m128i acc) {
+		__m256i v = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(src + (I << 2)));
+		if (B < 32)
+			v = _mm256_and_si256(v, mask);
+		__m256i lo = _mm256_sllv_epi32(v,
+				_mm256_setr_epi32(SHIFT0, SHIFT0, SHIFT0, SHIFT0, SHIFT1, SHIFT1,
+						SHIFT1, SHIFT1));
+		__m256i hi = _mm256_srlv_epi32(v,
+				_mm256_setr_epi32(RSHIFT0, RSHIFT0, RSHIFT0, RSHIFT0, RSHIFT1,
+						RSHIFT1, RSHIFT1, RSHIFT1));
+
+		acc = _mm_or_si128(acc, _mm256_castsi256_si128(lo));
+		if (SHIFT0 + B >= 32) {
+			KAFOR_STORE128(des + WORD0, acc);
+			acc = _mm256_castsi256_si128(hi);
+		}
+		acc = _mm_or_si128(acc, _mm256_extracti128_si256(lo, 1));
+		if (SHIFT1 + B >= 32) {
+			KAFOR_STORE128(des + WORD1, acc);
+			acc = _mm256_extracti128_si256(hi, 1);
+		}
+
+		KAFORSlotAVX2<B, OFF, I + 2, L>::pack(des, src, mask, acc);
+	}
+};
+
+template<uint32_t B, uint32_t OFF, uint32_t L>
+struct KAFORSlotAVX2<B, OFF, L, L> {
+	static const uint32_t BIT = OFF + L * B;
+
+	KAFOR_AVX2 static inline void unpack(uint32_t *des, const uint32_t *src,
+			__m256i mask) {
+	}
+
+	KAFOR_AVX2 static inline void pack(uint32_t *des, const uint32_t *src,
+			__m256i mask, __m128i acc) {
+		if (BIT & 31)
+			KAFOR_STORE128(des + ((BIT >> 5) << 2), acc);
+	}
+};
+
+template<uint32_t L, uint32_t B, uint32_t OFF>
+void KAFOR_unpack_sse(uint32_t *des, const uint32_t *src) {
+	KAFORSlotSSE<B, OFF, 0, L>::unpack(des, src,
+			_mm_set1_epi32(static_cast<int>(KAFOR_MASK(B))));
+}
+
+template<uint32_t L, uint32_t B, uint32_t OFF>
+void KAFOR_pack_sse(uint32_t *des, const uint32_t *src) {
+	/* Bits below OFF belong to a previous frame */
+	__m128i acc = (OFF != 0) ? KAFOR_LOAD128(des) : _mm_setzero_si128();
+	KAFORSlotSSE<B, OFF, 0, L>::pack(des, src,
+			_mm_set1_epi32(static_cast<int>(KAFOR_MASK(B))), acc);
+}
+
+template<uint32_t L, uint32_t B, uint32_t OFF>
+KAFOR_AVX2 void KAFOR_unpack_avx2(uint32_t *des, const uint32_t *src) {
+	KAFORSlotAVX2<B, OFF, 0, L>::unpack(des, src,
+			_mm256_set1_epi32(static_cast<int>(KAFOR_MASK(B))));
+}
+
+template<uint32_t L, uint32_t B, uint32_t OFF>
+KAFOR_AVX2 void KAFOR_pack_avx2(uint32_t *des, const uint32_t *src) {
+	__m128i acc = (OFF != 0) ? KAFOR_LOAD128(des) : _mm_setzero_si128();
+	KAFORSlotAVX2<B, OFF, 0, L>::pack(des, src,
+			_mm256_set1_epi32(static_cast<int>(KAFOR_MASK(B))), acc);
+}
+
+/*
+ * Fill the tables in the same order as KAFORUnpackInfoArr:
+ * IDX = ((frameLengthId + bitWidth - 1) << 2) + (offset >> 3)
+ */
+template<uint32_t IDX>
+struct KAFORKernelTable {
+	static const uint32_t L = 8U << (IDX >> 7);
+	static const uint32_t B = ((IDX >> 2) & 31) + 1;
+	static const uint32_t OFF = (IDX & 3) << 3;
+
+	static void fill(KAFORKernel *unpackSSE, KAFORKernel *packSSE,
+			KAFORKernel *unpackAVX2, KAFORKernel *packAVX2) {
+		unpackSSE[IDX] = KAFOR_unpack_sse<L, B, OFF>;
+		packSSE[IDX] = KAFOR_pack_sse<L, B, OFF>;
+		unpackAVX2[IDX] = KAFOR_unpack_avx2<L, B, OFF>;
+		packAVX2[IDX] = KAFOR_pack_avx2<L, B, OFF>;
+		KAFORKernelTable<IDX + 1>::fill(unpackSSE, packSSE, unpackAVX2,
+				packAVX2);
+	}
+};
+
+template<>
+struct KAFORKernelTable<KAFOR_NUM_KERNELS> {
+	static void fill(KAFORKernel *unpackSSE, KAFORKernel *packSSE,
+			KAFORKernel *unpackAVX2, KAFORKernel *packAVX2) {
+	}
+};
+
+} /* namespace: */
+
+#endif /* KAFOR_ENABLE_SIMD */
+
+namespace {
+
+struct KAFORKernelTables {
+	KAFORKernel m_unpack[3][KAFOR_NUM_KERNELS];
+	KAFORKernel m_pack[3][KAFOR_NUM_KERNELS];
+	int m_level;
+
+	KAFORKernelTables() :
+			m_level(KAFOR_KERNEL_SCALAR) {
+		for (uint32_t i = 0; i < KAFOR_NUM_KERNELS; i++) {
+			m_unpack[KAFOR_KERNEL_SCALAR][i] = KAFORUnpackInfoArr[i].m_subFunc;
+			m_pack[KAFOR_KERNEL_SCALAR][i] = KAFORPackInfoArr[i].m_subFunc;
+		}
+
+#ifdef KAFOR_ENABLE_SIMD
+		KAFORKernelTable<0>::fill(m_unpack[KAFOR_KERNEL_SSE],
+				m_pack[KAFOR_KERNEL_SSE], m_unpack[KAFOR_KERNEL_AVX2],
+				m_pack[KAFOR_KERNEL_AVX2]);
+
+		/* See encoding_dispatch.hpp for how the level is chosen */
+		int level = GetSimdLevel();
+		if (level >= SIMD_AVX2)
+			m_level = KAFOR_KERNEL_AVX2;
+		else if (level >= SIMD_SSE2)
+			m_level = KAFOR_KERNEL_SSE;
+#else
+		for (int level = KAFOR_KERNEL_SSE; level <= KAFOR_KERNEL_AVX2;
+				level++) {
+			memcpy(m_unpack[level], m_unpack[KAFOR_KERNEL_SCALAR],
+					sizeof(m_unpack[level]));
+			memcpy(m_pack[level], m_pack[KAFOR_KERNEL_SCALAR],
+					sizeof(m_pack[level]));
+		}
+#endif /* KAFOR_ENABLE_SIMD */
+	}
+};
+
+const KAFORKernelTables &kernelTables() {
+	static const KAFORKernelTables tables;
+	return tables;
+}
+
+} /* namespace: */
+
+const KAFORKernel *KAFORUnpackKernels() {
+	const KAFORKernelTables &t = kernelTables();
+	return t.m_unpack[t.m_level];
+}
+
+const KAFORKernel *KAFORPackKernels() {
+	const KAFORKernelTables &t = kernelTables();
+	return t.m_pack[t.m_level];
+}
+
+const KAFORKernel *KAFORUnpackKernels(int level) {
+	return kernelTables().m_unpack[level];
+}
+
+const KAFORKernel *KAFORPackKernels(int level) {
+	return kernelTables().m_pack[level];
+}
+
+int KAFORKernelLevel() {
+	return kernelTables().m_level;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
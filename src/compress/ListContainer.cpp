@@ -0,0 +1,899 @@
+/*-----------------------------------------------------------------------------
+ *  ListContainer.cpp - A self-describing file of compressed lists
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <compress/ListContainer.hpp>
+#include <integer_encoding.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#include <omp.h>
+#include <unistd.h>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+/* Offsets in 32-bit words must fit in 56 bits with a codec ID */
+const uint64_t LIST_CONTAINER_MAX_OFFSET = (1ULL << 56) - 1;
+
+bool IsValidAlignment(uint32_t align) {
+  return align == LIST_CONTAINER_ALIGN_WORD ||
+      align == LIST_CONTAINER_ALIGN_SIMD ||
+      align == LIST_CONTAINER_ALIGN_LINE ||
+      align == LIST_CONTAINER_ALIGN_PAGE;
+}
+
+void StoreHeader(char *buf, uint32_t align,
+                 uint64_t nlists, uint64_t diroff) {
+  BYTEORDER_FREE_STORE32(buf, LIST_CONTAINER_MAGIC);
+  BYTEORDER_FREE_STORE32(buf + 4, LIST_CONTAINER_VERSION);
+  BYTEORDER_FREE_STORE32(buf + 8, align);
+  BYTEORDER_FREE_STORE32(buf + 12, 0);
+  BYTEORDER_FREE_STORE64(buf + 16, nlists);
+  BYTEORDER_FREE_STORE64(buf + 24, diroff);
+}
+
+void StoreEntry(char *buf, const ListEntry& e) {
+  BYTEORDER_FREE_STORE64(buf, (e.offset << 8) | e.codec);
+  BYTEORDER_FREE_STORE32(buf + 8, e.len);
+  BYTEORDER_FREE_STORE32(buf + 12, e.num);
+  BYTEORDER_FREE_STORE32(buf + 16, e.base);
+  BYTEORDER_FREE_STORE32(buf + 20, e.crc);
+}
+
+/*
+ * Check a header and a footer of a file of [size] bytes, and
+ * read the alignment, # of lists and the offset of the directory
+ */
+void ParseFrame(const char *head, const char *ftr, uint64_t size,
+                uint32_t *align, uint64_t *nlists, uint64_t *diroff) {
+  if ((size & 3) != 0)
+    THROW_ENCODING_EXCEPTION("Invalid value: header");
+
+  if (BYTEORDER_FREE_LOAD32(ftr + 24) != LIST_CONTAINER_MAGIC ||
+      BYTEORDER_FREE_LOAD32(ftr + 28) != LIST_CONTAINER_VERSION ||
+      BYTEORDER_FREE_LOAD64(ftr + 16) != size)
+    THROW_ENCODING_EXCEPTION("Invalid value: footer");
+
+  /* The header is small enough to check every time */
+  if (BYTEORDER_FREE_LOAD32(ftr + 4) !=
+      Crc32c(head, LIST_CONTAINER_HEADER_SZ))
+    THROW_ENCODING_EXCEPTION("Checksum exception: header");
+
+  /* Files with 0 there come before the alignment option */
+  *align = BYTEORDER_FREE_LOAD32(head + 8);
+  if (*align == 0)
+    *align = LIST_CONTAINER_ALIGN_WORD;
+  if (!IsValidAlignment(*align))
+    THROW_ENCODING_EXCEPTION("Invalid value: header");
+
+  *nlists = BYTEORDER_FREE_LOAD64(head + 16);
+  *diroff = BYTEORDER_FREE_LOAD64(head + 24);
+
+  uint64_t maxlists = (size - LIST_CONTAINER_HEADER_SZ -
+      LIST_CONTAINER_FOOTER_SZ) / LIST_CONTAINER_ENTRY_SZ;
+
+  if (*nlists != BYTEORDER_FREE_LOAD64(ftr + 8) ||
+      *nlists > maxlists || *diroff < LIST_CONTAINER_HEADER_SZ ||
+      (*diroff & 3) != 0 ||
+      *diroff + *nlists * LIST_CONTAINER_ENTRY_SZ +
+          LIST_CONTAINER_FOOTER_SZ != size)
+    THROW_ENCODING_EXCEPTION("Invalid value: directory");
+}
+
+/* Read an entry, which must be before the directory */
+ListEntry LoadEntry(const char *p, uint64_t diroff) {
+  uint64_t w = BYTEORDER_FREE_LOAD64(p);
+
+  ListEntry e;
+  e.offset = w >> 8;
+  e.codec = static_cast<int>(w & 0xff);
+  e.len = BYTEORDER_FREE_LOAD32(p + 8);
+  e.num = BYTEORDER_FREE_LOAD32(p + 12);
+  e.base = BYTEORDER_FREE_LOAD32(p + 16);
+  e.crc = BYTEORDER_FREE_LOAD32(p + 20);
+
+  if (e.codec >= NUMCODERS ||
+      e.offset < (LIST_CONTAINER_HEADER_SZ >> 2) ||
+      e.offset + e.len > (diroff >> 2))
+    THROW_ENCODING_EXCEPTION("Invalid value: directory");
+
+  return e;
+}
+
+/* The room to encode [n] integers, where AFOR and KAFOR count bytes */
+uint64_t EncodeRoom(const EncodingPtr& c, uint64_t n) {
+  return std::max(c->require(n), 4 * n) + 128;
+}
+
+/* Decode a list into docids with the base in front */
+void DecodeDocids(const ListEntry& e, const uint32_t *payload,
+                  const EncodingPtr& c, std::vector<uint32_t> *docs) {
+  docs->resize(DECODE_REQUIRE_MEM(e.num) + 1);
+  (*docs)[0] = e.base;
+
+  if (e.num != 0) {
+    c->decodeArray(payload, e.len, docs->data() + 1, e.num);
+    if (e.codec != E_BINARYIPL)
+      GetSimdKernels().dgap(docs->data() + 1, e.num, e.base);
+  }
+
+  docs->resize(uint64_t(e.num) + 1);
+}
+
+} /* namespace: */
+
+ListContainerWriter::ListContainerWriter(const std::string& filename,
+                                         uint32_t align)
+    : fp_(NULL), pos_(0), align_(align), entries_(), gaps_() {
+  if (!IsValidAlignment(align))
+    THROW_ENCODING_EXCEPTION("Invalid value: align");
+
+  fp_ = fopen(filename.c_str(), "w");
+  if (fp_ == NULL)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+
+  /* Skip a header, and fill it finally */
+  char buf[LIST_CONTAINER_HEADER_SZ];
+  memset(buf, 0x00, sizeof(buf));
+  write(buf, sizeof(buf));
+}
+
+ListContainerWriter::ListContainerWriter(const std::string& filename,
+                                         const ListContainerReader& base)
+    : fp_(NULL), pos_(0), align_(base.alignment()),
+      entries_(), gaps_() {
+  fp_ = fopen(filename.c_str(), "w");
+  if (fp_ == NULL)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+
+  /* The header is copied with payloads, and filled finally */
+  write(base.addr_, base.diroff_);
+
+  entries_.reserve(base.size());
+  for (uint64_t i = 0; i < base.size(); i++)
+    entries_.push_back(base.entry(i));
+}
+
+ListContainerWriter::~ListContainerWriter() throw() {
+  if (fp_ != NULL)
+    fclose(fp_);
+}
+
+void ListContainerWriter::write(const void *buf, uint64_t n) {
+  if (fwrite(buf, 1, n, fp_) != n)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't write a file");
+  pos_ += n;
+}
+
+void ListContainerWriter::writeAt(uint64_t off,
+                                  const void *buf, uint64_t n) {
+  if (off == pos_) {
+    write(buf, n);
+    return;
+  }
+
+  /* Fill a gap, and go back to the tail */
+  if (fseeko(fp_, off, SEEK_SET) != 0 ||
+      fwrite(buf, 1, n, fp_) != n ||
+      fseeko(fp_, pos_, SEEK_SET) != 0)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't write a file");
+}
+
+void ListContainerWriter::pad(uint64_t n) {
+  static const char zeros[LIST_CONTAINER_ALIGN_PAGE] = {0};
+
+  if (n >= LIST_CONTAINER_ALIGN_WORD)
+    gaps_[pos_] = n;
+
+  while (n > 0) {
+    uint64_t m = (n < sizeof(zeros))? n : sizeof(zeros);
+    write(zeros, m);
+    n -= m;
+  }
+}
+
+uint64_t ListContainerWriter::place(uint64_t n) {
+  if (align_ == LIST_CONTAINER_ALIGN_WORD || n == 0)
+    return pos_;
+
+  uint64_t rem = pos_ % align_;
+
+  if (n >= align_) {
+    if (rem != 0)
+      pad(align_ - rem);
+    return pos_;
+  }
+
+  /* First fit in gaps, which never cross a boundary */
+  for (std::map<uint64_t, uint64_t>::iterator it = gaps_.begin();
+       it != gaps_.end(); ++it) {
+    if (it->second < n)
+      continue;
+
+    uint64_t off = it->first;
+    uint64_t left = it->second - n;
+
+    gaps_.erase(it);
+    if (left >= LIST_CONTAINER_ALIGN_WORD)
+      gaps_[off + n] = left;
+
+    return off;
+  }
+
+  if (rem + n > align_)
+    pad(align_ - rem);
+
+  return pos_;
+}
+
+ListEntry ListContainerWriter::put(int codec, uint32_t num,
+                                   uint32_t base,
+                                   const uint32_t *data,
+                                   uint64_t len) {
+  if (fp_ == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: closed");
+  if (codec < 0 || codec >= NUMCODERS)
+    THROW_ENCODING_EXCEPTION("Invalid value: codec");
+  if (data == NULL && len != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: data");
+  if (len > UINT32_MAX)
+    THROW_ENCODING_EXCEPTION("Out of range exception: len");
+
+  uint64_t off = place(len * 4);
+
+  ListEntry e;
+  e.offset = off >> 2;
+  e.len = static_cast<uint32_t>(len);
+  e.num = num;
+  e.base = base;
+  e.crc = Crc32c(data, len * 4);
+  e.codec = codec;
+
+  if (e.offset + len > LIST_CONTAINER_MAX_OFFSET)
+    THROW_ENCODING_EXCEPTION("Out of range exception: offset");
+
+  /* NOTE: the data in payloads are byte-order free */
+  writeAt(off, data, len * 4);
+
+  return e;
+}
+
+uint64_t ListContainerWriter::append(int codec, uint32_t num,
+                                     uint32_t base,
+                                     const uint32_t *data,
+                                     uint64_t len) {
+  entries_.push_back(put(codec, num, base, data, len));
+  return entries_.size() - 1;
+}
+
+void ListContainerWriter::update(uint64_t i, int codec, uint32_t num,
+                                 uint32_t base,
+                                 const uint32_t *data,
+                                 uint64_t len) {
+  if (i >= entries_.size())
+    THROW_ENCODING_EXCEPTION("Out of range exception: i");
+
+  entries_[i] = put(codec, num, base, data, len);
+}
+
+void ListContainerWriter::close() {
+  if (fp_ == NULL)
+    return;
+
+  uint64_t diroff = pos_;
+  uint32_t dircrc = 0;
+
+  for (uint64_t i = 0; i < entries_.size(); i++) {
+    char buf[LIST_CONTAINER_ENTRY_SZ];
+    StoreEntry(buf, entries_[i]);
+    dircrc = Crc32c(buf, sizeof(buf), dircrc);
+    write(buf, sizeof(buf));
+  }
+
+  char hdr[LIST_CONTAINER_HEADER_SZ];
+  StoreHeader(hdr, align_, entries_.size(), diroff);
+
+  char ftr[LIST_CONTAINER_FOOTER_SZ];
+  BYTEORDER_FREE_STORE32(ftr, dircrc);
+  BYTEORDER_FREE_STORE32(ftr + 4, Crc32c(hdr, sizeof(hdr)));
+  BYTEORDER_FREE_STORE64(ftr + 8, entries_.size());
+  BYTEORDER_FREE_STORE64(ftr + 16, pos_ + sizeof(ftr));
+  BYTEORDER_FREE_STORE32(ftr + 24, LIST_CONTAINER_MAGIC);
+  BYTEORDER_FREE_STORE32(ftr + 28, LIST_CONTAINER_VERSION);
+  write(ftr, sizeof(ftr));
+
+  /* Rewind, and fill the header */
+  if (fseeko(fp_, 0, SEEK_SET) != 0 ||
+      fwrite(hdr, 1, sizeof(hdr), fp_) != sizeof(hdr) ||
+      fflush(fp_) != 0 || fsync(fileno(fp_)) != 0)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't write a file");
+
+  fclose(fp_);
+  fp_ = NULL;
+}
+
+ListContainerReader::ListContainerReader(const std::string& filename)
+    : addr_(NULL), size_(0), mapped_(false),
+      nlists_(0), diroff_(0), align_(LIST_CONTAINER_ALIGN_WORD) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+
+  struct stat sb;
+  if (fstat(fd, &sb) == -1 || sb.st_size == 0) {
+    close(fd);
+    THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+  }
+
+  void *addr = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't map a file");
+
+  AdviseHugePages(addr, sb.st_size);
+
+  addr_ = reinterpret_cast<const uint32_t *>(addr);
+  size_ = sb.st_size;
+  mapped_ = true;
+
+  try {
+    parse();
+  } catch (...) {
+    munmap(const_cast<uint32_t *>(addr_), size_);
+    throw;
+  }
+}
+
+ListContainerReader::ListContainerReader(const uint32_t *addr,
+                                         uint64_t size)
+    : addr_(addr), size_(size), mapped_(false),
+      nlists_(0), diroff_(0), align_(LIST_CONTAINER_ALIGN_WORD) {
+  if (addr == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: addr");
+  parse();
+}
+
+ListContainerReader::~ListContainerReader() throw() {
+  if (mapped_)
+    munmap(const_cast<uint32_t *>(addr_), size_);
+}
+
+bool ListContainerReader::Probe(const uint32_t *addr, uint64_t size) {
+  return addr != NULL &&
+      size >= LIST_CONTAINER_HEADER_SZ + LIST_CONTAINER_FOOTER_SZ &&
+      BYTEORDER_FREE_LOAD32(addr) == LIST_CONTAINER_MAGIC &&
+      BYTEORDER_FREE_LOAD32(addr + 1) == LIST_CONTAINER_VERSION;
+}
+
+void ListContainerReader::parse() {
+  if (!Probe(addr_, size_))
+    THROW_ENCODING_EXCEPTION("Invalid value: header");
+
+  const char *head = reinterpret_cast<const char *>(addr_);
+  ParseFrame(head, head + size_ - LIST_CONTAINER_FOOTER_SZ, size_,
+             &align_, &nlists_, &diroff_);
+
+  for (int i = 0; i < NUMCODERS; i++)
+    codecs_[i] = EncodingFactory::create(i);
+}
+
+ListEntry ListContainerReader::entry(uint64_t i) const {
+  if (i >= nlists_)
+    THROW_ENCODING_EXCEPTION("Out of range exception: i");
+
+  return LoadEntry(reinterpret_cast<const char *>(addr_) +
+                   diroff_ + i * LIST_CONTAINER_ENTRY_SZ, diroff_);
+}
+
+void ListContainerReader::prefetch(uint64_t i) const {
+  if (i >= nlists_)
+    return;
+
+  ListEntry e = entry(i);
+  PrefetchBytes(payload(e), uint64_t(e.len) * 4);
+}
+
+void ListContainerReader::advise(uint64_t i, uint64_t n) const {
+  if (!mapped_ || i >= nlists_)
+    return;
+  if (n > nlists_ - i)
+    n = nlists_ - i;
+
+  /* Lists in gaps of alignment may come before others */
+  uint64_t head = diroff_ >> 2;
+  uint64_t tail = 0;
+  for (uint64_t j = i; j < i + n; j++) {
+    ListEntry e = entry(j);
+    head = std::min(head, e.offset);
+    tail = std::max(tail, e.offset + e.len);
+  }
+
+  if (head < tail)
+    AdviseWillNeed(addr_ + head, (tail - head) * 4);
+}
+
+bool ListContainerReader::verifyDirectory() const {
+  const char *head = reinterpret_cast<const char *>(addr_);
+  const char *ftr = head + size_ - LIST_CONTAINER_FOOTER_SZ;
+
+  return BYTEORDER_FREE_LOAD32(ftr) ==
+      Crc32c(head + diroff_, nlists_ * LIST_CONTAINER_ENTRY_SZ);
+}
+
+bool ListContainerReader::verify(uint64_t i) const {
+  ListEntry e = entry(i);
+  return Crc32c(payload(e), uint64_t(e.len) * 4) == e.crc;
+}
+
+uint64_t ListContainerReader::verifyAll(int nthreads) const {
+  uint64_t nbroken = (verifyDirectory())? 0 : 1;
+  int64_t n = nlists_;
+
+  if (nthreads <= 0)
+    nthreads = omp_get_max_threads();
+
+#pragma omp parallel for num_threads(nthreads) \
+    schedule(dynamic, 64) reduction(+:nbroken)
+  for (int64_t i = 0; i < n; i++) {
+    try {
+      if (!verify(i))
+        nbroken++;
+    } catch (const encoding_exception&) {
+      nbroken++;
+    }
+  }
+
+  return nbroken;
+}
+
+void ListContainerReader::decode(uint64_t i, uint32_t *out,
+                                 bool verified) const {
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+
+  ListEntry e = entry(i);
+
+  if (verified && Crc32c(payload(e), uint64_t(e.len) * 4) != e.crc)
+    THROW_ENCODING_EXCEPTION("Checksum exception: list");
+
+  if (e.num != 0)
+    codecs_[e.codec]->decodeArray(payload(e), e.len, out, e.num);
+}
+
+ListFetcher::ListFetcher(const std::string& filename,
+                         uint32_t depth, int nthreads)
+    : fd_(open(filename.c_str(), O_RDONLY)), size_(0),
+      nlists_(0), diroff_(0), align_(LIST_CONTAINER_ALIGN_WORD),
+      dir_(), aio_() {
+  if (fd_ == -1)
+    THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+
+  try {
+    struct stat sb;
+    if (fstat(fd_, &sb) == -1)
+      THROW_ENCODING_EXCEPTION("I/O exception: can't open a file");
+    size_ = sb.st_size;
+
+    /* Read the header, footer and directory, but no payload */
+    uint32_t hdr[LIST_CONTAINER_HEADER_SZ >> 2];
+    char ftr[LIST_CONTAINER_FOOTER_SZ];
+    if (size_ < sizeof(hdr) + sizeof(ftr) ||
+        pread(fd_, hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+        pread(fd_, ftr, sizeof(ftr), size_ - sizeof(ftr)) != sizeof(ftr) ||
+        !ListContainerReader::Probe(hdr, size_))
+      THROW_ENCODING_EXCEPTION("Invalid value: header");
+
+    ParseFrame(reinterpret_cast<const char *>(hdr), ftr, size_,
+               &align_, &nlists_, &diroff_);
+
+    /* The whole directory is read anyway, so check it at once */
+    dir_.resize(nlists_ * LIST_CONTAINER_ENTRY_SZ);
+    if (!dir_.empty() &&
+        pread(fd_, dir_.data(), dir_.size(), diroff_) !=
+            static_cast<ssize_t>(dir_.size()))
+      THROW_ENCODING_EXCEPTION("I/O exception: can't read a file");
+    if (BYTEORDER_FREE_LOAD32(ftr) != Crc32c(dir_.data(), dir_.size()))
+      THROW_ENCODING_EXCEPTION("Checksum exception: directory");
+
+    aio_.reset(new AioReader(fd_, depth, nthreads));
+  } catch (...) {
+    close(fd_);
+    throw;
+  }
+
+  for (int i = 0; i < NUMCODERS; i++)
+    codecs_[i] = EncodingFactory::create(i);
+}
+
+ListFetcher::~ListFetcher() throw() {
+  aio_.reset();
+  close(fd_);
+}
+
+ListEntry ListFetcher::entry(uint64_t i) const {
+  if (i >= nlists_)
+    THROW_ENCODING_EXCEPTION("Out of range exception: i");
+
+  return LoadEntry(dir_.data() + i * LIST_CONTAINER_ENTRY_SZ, diroff_);
+}
+
+void ListFetcher::fetch(const uint64_t *ids, uint64_t n,
+                        const callback_t& fn, bool verified) {
+  if (ids == NULL && n != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: ids");
+
+  /* Payloads of a batch are read into a single buffer */
+  std::vector<ListEntry> entries(n);
+  std::vector<AioRequest> reqs(n);
+  std::vector<uint64_t> heads(n);
+  uint64_t total = 0;
+
+  for (uint64_t k = 0; k < n; k++) {
+    entries[k] = entry(ids[k]);
+    heads[k] = total;
+    total += entries[k].len;
+  }
+
+  std::vector<uint32_t> payloads(total);
+  for (uint64_t k = 0; k < n; k++) {
+    reqs[k].buf = payloads.data() + heads[k];
+    reqs[k].off = entries[k].offset * 4;
+    reqs[k].len = uint64_t(entries[k].len) * 4;
+  }
+
+  aio_->read(reqs.data(), n, [&](uint64_t k) {
+    const ListEntry& e = entries[k];
+    const uint32_t *in = payloads.data() + heads[k];
+
+    if (verified && Crc32c(in, uint64_t(e.len) * 4) != e.crc)
+      THROW_ENCODING_EXCEPTION("Checksum exception: list");
+
+    /* Each thread decodes in its own buffer */
+    static thread_local std::vector<uint32_t> list;
+    list.resize(DECODE_REQUIRE_MEM(e.num));
+
+    if (e.num != 0)
+      codecs_[e.codec]->decodeArray(in, e.len, list.data(), e.num);
+    fn(k, e, list.data());
+  });
+}
+
+ListContainerAppender::ListContainerAppender(const std::string& src,
+                                             const std::string& dst)
+    : reader_(new ListContainerReader(src)),
+      writer_(), pending_() {
+  if (!reader_->verifyDirectory())
+    THROW_ENCODING_EXCEPTION("Checksum exception: directory");
+
+  writer_.reset(new ListContainerWriter(dst, *reader_));
+
+  for (int i = 0; i < NUMCODERS; i++)
+    codecs_[i] = EncodingFactory::create(i);
+}
+
+ListContainerAppender::~ListContainerAppender() throw() {}
+
+void ListContainerAppender::append(uint64_t i, const uint32_t *data,
+                                   uint64_t n) {
+  if (i >= reader_->size())
+    THROW_ENCODING_EXCEPTION("Out of range exception: i");
+  if (data == NULL && n != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: data");
+
+  std::vector<uint32_t>& list = pending_[i];
+  list.insert(list.end(), data, data + n);
+}
+
+uint64_t ListContainerAppender::add(int codec, uint32_t base,
+                                    const uint32_t *data, uint64_t n) {
+  if (codec < 0 || codec >= NUMCODERS)
+    THROW_ENCODING_EXCEPTION("Invalid value: codec");
+  if (data == NULL || n == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: data");
+  if (n > UINT32_MAX)
+    THROW_ENCODING_EXCEPTION("Out of range exception: n");
+
+  EncodingPtr c = codecs_[codec];
+  uint64_t nvalue = EncodeRoom(c, n);
+  REGISTER_VECTOR_RAII(uint32_t, out, nvalue);
+
+  c->encodeArray(data, n, out, &nvalue);
+  return writer_->append(codec, n, base, out, nvalue);
+}
+
+uint64_t ListContainerAppender::close() {
+  uint64_t nlists = 0;
+
+  for (std::map<uint64_t, std::vector<uint32_t> >::const_iterator it =
+           pending_.begin(); it != pending_.end(); ++it) {
+    const std::vector<uint32_t>& list = it->second;
+    if (list.empty())
+      continue;
+
+    ListEntry e = reader_->entry(it->first);
+    if (!reader_->verify(it->first))
+      THROW_ENCODING_EXCEPTION("Checksum exception: list");
+
+    uint64_t num = uint64_t(e.num) + list.size();
+    if (num > UINT32_MAX)
+      THROW_ENCODING_EXCEPTION("Out of range exception: num");
+
+    EncodingPtr c = codecs_[e.codec];
+    uint64_t nvalue = EncodeRoom(c, num);
+    REGISTER_VECTOR_RAII(uint32_t, out, nvalue);
+
+    c->appendArray(reader_->payload(e), e.len, e.num,
+                   list.data(), list.size(), out, &nvalue);
+    writer_->update(it->first, e.codec, num, e.base, out, nvalue);
+    nlists++;
+  }
+
+  pending_.clear();
+  writer_->close();
+
+  return nlists;
+}
+
+/* A list to write, which points to a payload if it is copied */
+struct ListContainerMerger::Merged {
+  enum { COPIED, SPLICED, MERGED } way;
+
+  int                    codec;
+  uint32_t               num;
+  uint32_t               base;
+  const uint32_t         *data;
+  uint64_t               len;
+  std::vector<uint32_t>  buf;
+
+  Merged()
+      : way(COPIED), codec(E_INVALID), num(0), base(0),
+        data(NULL), len(0), buf() {}
+};
+
+ListContainerMerger::ListContainerMerger(
+    const std::vector<std::string>& srcs, const ListMergeConfig& conf)
+    : readers_(), conf_(conf), nlists_(0) {
+  if (srcs.empty())
+    THROW_ENCODING_EXCEPTION("Invalid input: srcs");
+  if (conf.codec < -1 || conf.codec >= NUMCODERS)
+    THROW_ENCODING_EXCEPTION("Invalid value: codec");
+  if (conf.align != 0 && !IsValidAlignment(conf.align))
+    THROW_ENCODING_EXCEPTION("Invalid value: align");
+  if (conf.budget == 0)
+    THROW_ENCODING_EXCEPTION("Invalid value: budget");
+
+  for (size_t s = 0; s < srcs.size(); s++) {
+    readers_.emplace_back(new ListContainerReader(srcs[s]));
+    if (!readers_.back()->verifyDirectory())
+      THROW_ENCODING_EXCEPTION("Checksum exception: directory");
+
+    nlists_ = std::max(nlists_, readers_.back()->size());
+  }
+
+  if (conf_.align == 0)
+    conf_.align = readers_[0]->alignment();
+}
+
+ListContainerMerger::~ListContainerMerger() throw() {}
+
+void ListContainerMerger::mergeList(uint64_t i, const EncodingPtr *codecs,
+                                    Merged *m) const {
+  /* Segments with the list in order of their first docids */
+  std::vector<std::pair<uint32_t, size_t> > parts;
+  for (size_t s = 0; s < readers_.size(); s++) {
+    if (i < readers_[s]->size())
+      parts.push_back(std::make_pair(readers_[s]->entry(i).base, s));
+  }
+  std::sort(parts.begin(), parts.end());
+
+  for (size_t j = 0; conf_.verify && j < parts.size(); j++) {
+    if (!readers_[parts[j].second]->verify(i))
+      THROW_ENCODING_EXCEPTION("Checksum exception: list");
+  }
+
+  const ListContainerReader& first = *readers_[parts[0].second];
+  ListEntry e = first.entry(i);
+  int codec = (conf_.codec < 0)? e.codec : conf_.codec;
+
+  m->codec = codec;
+  m->base = e.base;
+
+  if (parts.size() == 1 && codec == e.codec) {
+    m->way = Merged::COPIED;
+    m->num = e.num;
+    m->data = first.payload(e);
+    m->len = e.len;
+    return;
+  }
+
+  std::vector<std::vector<uint32_t> > docs(parts.size());
+  uint64_t total = 0;
+  bool disjoint = true;
+
+  for (size_t j = 0; j < parts.size(); j++) {
+    const ListContainerReader& rd = *readers_[parts[j].second];
+    ListEntry p = rd.entry(i);
+
+    DecodeDocids(p, rd.payload(p), codecs[p.codec], &docs[j]);
+    total += docs[j].size();
+
+    if (j > 0 && docs[j - 1].back() >= docs[j].front())
+      disjoint = false;
+  }
+
+  if (total - 1 > UINT32_MAX)
+    THROW_ENCODING_EXCEPTION("Out of range exception: num");
+
+  EncodingPtr c = codecs[codec];
+  bool bip = (codec == E_BINARYIPL);
+
+  if (disjoint && codec == e.codec) {
+    /* The first range is kept, and the others go after it */
+    std::vector<uint32_t> add;
+    add.reserve(total - docs[0].size());
+
+    uint32_t prev = docs[0].back();
+    for (size_t j = 1; j < docs.size(); j++) {
+      for (size_t k = 0; k < docs[j].size(); k++) {
+        add.push_back((bip)? docs[j][k] : docs[j][k] - prev - 1);
+        prev = docs[j][k];
+      }
+    }
+
+    m->way = Merged::SPLICED;
+    m->num = total - 1;
+    m->buf.resize(EncodeRoom(c, m->num));
+    m->len = m->buf.size();
+
+    c->appendArray(first.payload(e), e.len, e.num, add.data(), add.size(),
+                   m->buf.data(), &m->len);
+    m->data = m->buf.data();
+    return;
+  }
+
+  /* k-way merge, where a docid in several segments is taken once */
+  typedef std::pair<uint32_t, size_t> head_t;
+  std::priority_queue<head_t, std::vector<head_t>,
+                      std::greater<head_t> > heads;
+  std::vector<size_t> pos(docs.size(), 0);
+
+  for (size_t j = 0; j < docs.size(); j++)
+    heads.push(std::make_pair(docs[j][0], j));
+
+  std::vector<uint32_t> all;
+  all.reserve(total);
+
+  while (!heads.empty()) {
+    head_t h = heads.top();
+    heads.pop();
+
+    if (all.empty() || all.back() != h.first)
+      all.push_back(h.first);
+    if (++pos[h.second] < docs[h.second].size())
+      heads.push(std::make_pair(docs[h.second][pos[h.second]], h.second));
+  }
+
+  /* Turn docids into d-gaps from the tail, and free inputs first */
+  std::vector<std::vector<uint32_t> >().swap(docs);
+  for (size_t k = all.size() - 1; !bip && k > 0; k--)
+    all[k] = all[k] - all[k - 1] - 1;
+
+  m->way = Merged::MERGED;
+  m->num = all.size() - 1;
+  m->len = 0;
+
+  if (m->num != 0) {
+    m->buf.resize(EncodeRoom(c, m->num));
+    m->len = m->buf.size();
+    c->encodeArray(all.data() + 1, m->num, m->buf.data(), &m->len);
+  }
+
+  m->data = m->buf.data();
+}
+
+void ListContainerMerger::merge(const std::string& dst,
+                                ListMergeStats *stats) const {
+  ListContainerWriter w(dst, conf_.align);
+
+  int nthreads = conf_.nthreads;
+  if (nthreads <= 0)
+    nthreads = omp_get_max_threads();
+
+  /* Codecs of each thread, which never share encoders */
+  std::vector<EncodingPtr> codecs(uint64_t(nthreads) * NUMCODERS);
+  for (uint64_t k = 0; k < codecs.size(); k++)
+    codecs[k] = EncodingFactory::create(k % NUMCODERS);
+
+  ListMergeStats st;
+  std::vector<Merged> batch;
+
+  for (uint64_t head = 0; head < nlists_;) {
+    /* A batch takes lists until they reach the budget */
+    uint64_t n = 0;
+    uint64_t nums = 0;
+    do {
+      for (size_t s = 0; s < readers_.size(); s++) {
+        if (head + n < readers_[s]->size())
+          nums += uint64_t(readers_[s]->entry(head + n).num) + 1;
+      }
+      n++;
+    } while (head + n < nlists_ && nums < conf_.budget);
+
+    for (size_t s = 0; s < readers_.size(); s++)
+      readers_[s]->advise(head, n);
+
+    batch.clear();
+    batch.resize(n);
+
+    bool failed = false;
+    std::exception_ptr err;
+    int64_t num = n;
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1)
+    for (int64_t k = 0; k < num; k++) {
+      bool skip;
+#pragma omp atomic read
+      skip = failed;
+      if (skip)
+        continue;
+
+      try {
+        mergeList(head + k,
+                  codecs.data() + uint64_t(omp_get_thread_num()) * NUMCODERS,
+                  &batch[k]);
+      } catch (...) {
+#pragma omp critical(list_merger)
+        {
+          if (!failed)
+            err = std::current_exception();
+#pragma omp atomic write
+          failed = true;
+        }
+      }
+    }
+
+    if (failed)
+      std::rethrow_exception(err);
+
+    /* Lists are written in order, so the merged file is stable */
+    for (uint64_t k = 0; k < n; k++) {
+      const Merged& m = batch[k];
+      w.append(m.codec, m.num, m.base, m.data, m.len);
+
+      st.nums += uint64_t(m.num) + 1;
+      if (m.way == Merged::COPIED)
+        st.copied++;
+      else if (m.way == Merged::SPLICED)
+        st.spliced++;
+      else
+        st.merged++;
+    }
+
+    head += n;
+  }
+
+  w.close();
+
+  if (stats != NULL)
+    *stats = st;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
@@ -15,6 +15,12 @@
  */
 
 #include <compress/policy/VSEncodingBlocks.hpp>
+#include <misc/encoding_bitpack.hpp>
+#include <misc/encoding_threaded.hpp>
+
+#include <algorithm>
+#include <vector>
+#include <omp.h>
 
 namespace integer_encoding {
 namespace internals {
@@ -30,618 +36,6 @@ const uint32_t VSEBLOCKS_LENS_LEN = 1U << VSEBLOCKS_LOGLEN;
 const uint32_t VSEBLOCKS_LOGS_LEN = 1U << VSEBLOCKS_LOGLOG;
 const uint32_t VSEBLOCKS_DESC_LEN = 1U << VSEBLOCKS_LOGDESC;
 
-inline void VSEBLOCKS_UNPACK1(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 1) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 31;
-    out[1] = (val >> 30) & 0x01;
-    out[2] = (val >> 29) & 0x01;
-    out[3] = (val >> 28) & 0x01;
-    out[4] = (val >> 27) & 0x01;
-    out[5] = (val >> 26) & 0x01;
-    out[6] = (val >> 25) & 0x01;
-    out[7] = (val >> 24) & 0x01;
-    out[8] = (val >> 23) & 0x01;
-    out[9] = (val >> 22) & 0x01;
-    out[10] = (val >> 21) & 0x01;
-    out[11] = (val >> 20) & 0x01;
-    out[12] = (val >> 19) & 0x01;
-    out[13] = (val >> 18) & 0x01;
-    out[14] = (val >> 17) & 0x01;
-    out[15] = (val >> 16) & 0x01;
-    out[16] = (val >> 15) & 0x01;
-    out[17] = (val >> 14) & 0x01;
-    out[18] = (val >> 13) & 0x01;
-    out[19] = (val >> 12) & 0x01;
-    out[20] = (val >> 11) & 0x01;
-    out[21] = (val >> 10) & 0x01;
-    out[22] = (val >> 9) & 0x01;
-    out[23] = (val >> 8) & 0x01;
-    out[24] = (val >> 7) & 0x01;
-    out[25] = (val >> 6) & 0x01;
-    out[26] = (val >> 5) & 0x01;
-    out[27] = (val >> 4) & 0x01;
-    out[28] = (val >> 3) & 0x01;
-    out[29] = (val >> 2) & 0x01;
-    out[30] = (val >> 1) & 0x01;
-    out[31] = val & 0x01;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK2(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 16, out += 16, in += 1) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 30;
-    out[1] = (val >> 28) & 0x03;
-    out[2] = (val >> 26) & 0x03;
-    out[3] = (val >> 24) & 0x03;
-    out[4] = (val >> 22) & 0x03;
-    out[5] = (val >> 20) & 0x03;
-    out[6] = (val >> 18) & 0x03;
-    out[7] = (val >> 16) & 0x03;
-    out[8] = (val >> 14) & 0x03;
-    out[9] = (val >> 12) & 0x03;
-    out[10] = (val >> 10) & 0x03;
-    out[11] = (val >> 8) & 0x03;
-    out[12] = (val >> 6) & 0x03;
-    out[13] = (val >> 4) & 0x03;
-    out[14] = (val >> 2) & 0x03;
-    out[15] = val & 0x03;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK3(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 3) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 29;
-    out[1] = (val >> 26) & 0x07;
-    out[2] = (val >> 23) & 0x07;
-    out[3] = (val >> 20) & 0x07;
-    out[4] = (val >> 17) & 0x07;
-    out[5] = (val >> 14) & 0x07;
-    out[6] = (val >> 11) & 0x07;
-    out[7] = (val >> 8) & 0x07;
-    out[8] = (val >> 5) & 0x07;
-    out[9] = (val >> 2) & 0x07;
-    out[10] = (val << 1) & 0x07;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[10] |= val >> 31;
-    out[11] = (val >> 28) & 0x07;
-    out[12] = (val >> 25) & 0x07;
-    out[13] = (val >> 22) & 0x07;
-    out[14] = (val >> 19) & 0x07;
-    out[15] = (val >> 16) & 0x07;
-    out[16] = (val >> 13) & 0x07;
-    out[17] = (val >> 10) & 0x07;
-    out[18] = (val >> 7) & 0x07;
-    out[19] = (val >> 4) & 0x07;
-    out[20] = (val >> 1) & 0x07;
-    out[21] = (val << 2) & 0x07;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[21] |= val >> 30;
-    out[22] = (val >> 27) & 0x07;
-    out[23] = (val >> 24) & 0x07;
-    out[24] = (val >> 21) & 0x07;
-    out[25] = (val >> 18) & 0x07;
-    out[26] = (val >> 15) & 0x07;
-    out[27] = (val >> 12) & 0x07;
-    out[28] = (val >> 9) & 0x07;
-    out[29] = (val >> 6) & 0x07;
-    out[30] = (val >> 3) & 0x07;
-    out[31] = val & 0x07;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK4(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 8, out += 8, in += 1) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 28;
-    out[1] = (val >> 24) & 0x0f;
-    out[2] = (val >> 20) & 0x0f;
-    out[3] = (val >> 16) & 0x0f;
-    out[4] = (val >> 12) & 0x0f;
-    out[5] = (val >> 8) & 0x0f;
-    out[6] = (val >> 4) & 0x0f;
-    out[7] = val & 0x0f;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK5(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 5) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 27;
-    out[1] = (val >> 22) & 0x1f;
-    out[2] = (val >> 17) & 0x1f;
-    out[3] = (val >> 12) & 0x1f;
-    out[4] = (val >> 7) & 0x1f;
-    out[5] = (val >> 2) & 0x1f;
-    out[6] = (val << 3) & 0x1f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[6] |= val >> 29;
-    out[7] = (val >> 24) & 0x1f;
-    out[8] = (val >> 19) & 0x1f;
-    out[9] = (val >> 14) & 0x1f;
-    out[10] = (val >> 9) & 0x1f;
-    out[11] = (val >> 4) & 0x1f;
-    out[12] = (val << 1) & 0x1f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[12] |= val >> 0x1f;
-    out[13] = (val >> 26) & 0x1f;
-    out[14] = (val >> 21) & 0x1f;
-    out[15] = (val >> 16) & 0x1f;
-    out[16] = (val >> 11) & 0x1f;
-    out[17] = (val >> 6) & 0x1f;
-    out[18] = (val >> 1) & 0x1f;
-    out[19] = (val << 4) & 0x1f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[19] |= val >> 28;
-    out[20] = (val >> 23) & 0x1f;
-    out[21] = (val >> 18) & 0x1f;
-    out[22] = (val >> 13) & 0x1f;
-    out[23] = (val >> 8) & 0x1f;
-    out[24] = (val >> 3) & 0x1f;
-    out[25] = (val << 2) & 0x1f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[25] |= val >> 30;
-    out[26] = (val >> 25) & 0x1f;
-    out[27] = (val >> 20) & 0x1f;
-    out[28] = (val >> 15) & 0x1f;
-    out[29] = (val >> 10) & 0x1f;
-    out[30] = (val >> 5) & 0x1f;
-    out[31] = val & 0x1f;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK6(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 16, out += 16, in += 3) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 26;
-    out[1] = (val >> 20) & 0x3f;
-    out[2] = (val >> 14) & 0x3f;
-    out[3] = (val >> 8) & 0x3f;
-    out[4] = (val >> 2) & 0x3f;
-    out[5] = (val << 4) & 0x3f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[5] |= val >> 28;
-    out[6] = (val >> 22) & 0x3f;
-    out[7] = (val >> 16) & 0x3f;
-    out[8] = (val >> 10) & 0x3f;
-    out[9] = (val >> 4) & 0x3f;
-    out[10] = (val << 2) & 0x3f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[10] |= val >> 30;
-    out[11] = (val >> 24) & 0x3f;
-    out[12] = (val >> 18) & 0x3f;
-    out[13] = (val >> 12) & 0x3f;
-    out[14] = (val >> 6) & 0x3f;
-    out[15] = val & 0x3f;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK7(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 7) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 25;
-    out[1] = (val >> 18) & 0x7f;
-    out[2] = (val >> 11) & 0x7f;
-    out[3] = (val >> 4) & 0x7f;
-    out[4] = (val << 3) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[4] |= val >> 29;
-    out[5] = (val >> 22) & 0x7f;
-    out[6] = (val >> 15) & 0x7f;
-    out[7] = (val >> 8) & 0x7f;
-    out[8] = (val >> 1) & 0x7f;
-    out[9] = (val << 6) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[9] |= val >> 26;
-    out[10] = (val >> 19) & 0x7f;
-    out[11] = (val >> 12) & 0x7f;
-    out[12] = (val >> 5) & 0x7f;
-    out[13] = (val << 2) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[13] |= val >> 30;
-    out[14] = (val >> 23) & 0x7f;
-    out[15] = (val >> 16) & 0x7f;
-    out[16] = (val >> 9) & 0x7f;
-    out[17] = (val >> 2) & 0x7f;
-    out[18] = (val << 5) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[18] |= val >> 27;
-    out[19] = (val >> 20) & 0x7f;
-    out[20] = (val >> 13) & 0x7f;
-    out[21] = (val >> 6) & 0x7f;
-    out[22] = (val << 1) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 5);
-
-    out[22] |= val >> 31;
-    out[23] = (val >> 24) & 0x7f;
-    out[24] = (val >> 17) & 0x7f;
-    out[25] = (val >> 10) & 0x7f;
-    out[26] = (val >> 3) & 0x7f;
-    out[27] = (val << 4) & 0x7f;
-
-    val = BYTEORDER_FREE_LOAD32(in + 6);
-
-    out[27] |= val >> 28;
-    out[28] = (val >> 21) & 0x7f;
-    out[29] = (val >> 14) & 0x7f;
-    out[30] = (val >> 7) & 0x7f;
-    out[31] = val & 0x7f;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK8(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 4, out += 4, in += 1) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 24;
-    out[1] = (val >> 16) & 0xff;
-    out[2] = (val >> 8) & 0xff;
-    out[3] = val & 0xff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK9(uint32_t * restrict out,
-                              const uint32_t * restrict in,
-                              uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 9) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 23;
-    out[1] = (val >> 14) & 0x01ff;
-    out[2] = (val >> 5) & 0x01ff;
-    out[3] = (val << 4) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[3] |= val >> 28;
-    out[4] = (val >> 19) & 0x01ff;
-    out[5] = (val >> 10) & 0x01ff;
-    out[6] = (val >> 1) & 0x01ff;
-    out[7] = (val << 8) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[7] |= val >> 24;
-    out[8] = (val >> 15) & 0x01ff;
-    out[9] = (val >> 6) & 0x01ff;
-    out[10] = (val << 3) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[10] |= val >> 29;
-    out[11] = (val >> 20) & 0x01ff;
-    out[12] = (val >> 11) & 0x01ff;
-    out[13] = (val >> 2) & 0x01ff;
-    out[14] = (val << 7) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[14] |= val >> 25;
-    out[15] = (val >> 16) & 0x01ff;
-    out[16] = (val >> 7) & 0x01ff;
-    out[17] = (val << 2) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 5);
-
-    out[17] |= val >> 30;
-    out[18] = (val >> 21) & 0x01ff;
-    out[19] = (val >> 12) & 0x01ff;
-    out[20] = (val >> 3) & 0x01ff;
-    out[21] = (val << 6) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 6);
-
-    out[21] |= val >> 26;
-    out[22] = (val >> 17) & 0x01ff;
-    out[23] = (val >> 8) & 0x01ff;
-    out[24] = (val << 1) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 7);
-
-    out[24] |= val >> 31;
-    out[25] = (val >> 22) & 0x01ff;
-    out[26] = (val >> 13) & 0x01ff;
-    out[27] = (val >> 4) & 0x01ff;
-    out[28] = (val << 5) & 0x01ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 8);
-
-    out[28] |= val >> 27;
-    out[29] = (val >> 18) & 0x01ff;
-    out[30] = (val >> 9) & 0x01ff;
-    out[31] = val & 0x01ff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK10(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 16, out += 16, in += 5) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 22;
-    out[1] = (val >> 12) & 0x03ff;
-    out[2] = (val >> 2) & 0x03ff;
-    out[3] = (val << 8) & 0x03ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[3] |= val >> 24;
-    out[4] = (val >> 14) & 0x03ff;
-    out[5] = (val >> 4) & 0x03ff;
-    out[6] = (val << 6) & 0x03ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[6] |= val >> 26;
-    out[7] = (val >> 16) & 0x03ff;
-    out[8] = (val >> 6) & 0x03ff;
-    out[9] = (val << 4) & 0x03ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[9] |= val >> 28;
-    out[10] = (val >> 18) & 0x03ff;
-    out[11] = (val >> 8) & 0x03ff;
-    out[12] = (val << 2) & 0x03ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[12] |= val >> 30;
-    out[13] = (val >> 20) & 0x03ff;
-    out[14] = (val >> 10) & 0x03ff;
-    out[15] = val & 0x03ff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK11(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 32, out += 32, in += 11) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 21;
-    out[1] = (val >> 10) & 0x07ff;
-    out[2] = (val << 1) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[2] |= val >> 31;
-    out[3] = (val >> 20) & 0x07ff;
-    out[4] = (val >> 9) & 0x07ff;
-    out[5] = (val << 2) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[5] |= val >> 30;
-    out[6] = (val >> 19) & 0x07ff;
-    out[7] = (val >> 8) & 0x07ff;
-    out[8] = (val << 3) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[8] |= val >> 29;
-    out[9] = (val >> 18) & 0x07ff;
-    out[10] = (val >> 7) & 0x07ff;
-    out[11] = (val << 4) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[11] |= val >> 28;
-    out[12] = (val >> 17) & 0x07ff;
-    out[13] = (val >> 6) & 0x07ff;
-    out[14] = (val << 5) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 5);
-
-    out[14] |= val >> 27;
-    out[15] = (val >> 16) & 0x07ff;
-    out[16] = (val >> 5) & 0x07ff;
-    out[17] = (val << 6) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 6);
-
-    out[17] |= val >> 26;
-    out[18] = (val >> 15) & 0x07ff;
-    out[19] = (val >> 4) & 0x07ff;
-    out[20] = (val << 7) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 7);
-
-    out[20] |= val >> 25;
-    out[21] = (val >> 14) & 0x07ff;
-    out[22] = (val >> 3) & 0x07ff;
-    out[23] = (val << 8) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 8);
-
-    out[23] |= val >> 24;
-    out[24] = (val >> 13) & 0x07ff;
-    out[25] = (val >> 2) & 0x07ff;
-    out[26] = (val << 9) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 9);
-
-    out[26] |= val >> 23;
-    out[27] = (val >> 12) & 0x07ff;
-    out[28] = (val >> 1) & 0x07ff;
-    out[29] = (val << 10) & 0x07ff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 10);
-
-    out[29] |= val >> 22;
-    out[30] = (val >> 11) & 0x07ff;
-    out[31] = val  & 0x07ff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK12(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 8, out += 8, in += 3) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 20;
-    out[1] = (val >> 8) & 0x0fff;
-    out[2] = (val << 4) & 0x0fff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[2] |= val >> 28;
-    out[3] = (val >> 16) & 0x0fff;
-    out[4] = (val >> 4) & 0x0fff;
-    out[5] = (val << 8) & 0x0fff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[5] |= val >> 24;
-    out[6] = (val >> 12) & 0x0fff;
-    out[7] = val & 0x0fff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK16(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 2, out += 2, in += 1) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 16;
-    out[1] = val & 0xffff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK20(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 8, out += 8, in += 5) {
-    uint32_t val = BYTEORDER_FREE_LOAD32(in);
-
-    out[0] = val >> 12;
-    out[1] = (val << 8) & 0x0fffff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 1);
-
-    out[1] |= val >> 24;
-    out[2] = (val >> 4) & 0x0fffff;
-    out[3] = (val << 16) & 0x0fffff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 2);
-
-    out[3] |= val >> 16;
-    out[4] = (val << 4) & 0x0fffff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 3);
-
-    out[4] |= val >> 28;
-    out[5] = (val >> 8) & 0x0fffff;
-    out[6] = (val << 12) & 0x0fffff;
-
-    val = BYTEORDER_FREE_LOAD32(in + 4);
-
-    out[6] |= val >> 20;
-    out[7] = val & 0x0fffff;
-  }
-}
-
-inline void VSEBLOCKS_UNPACK32(uint32_t * restrict out,
-                               const uint32_t * restrict in,
-                               uint32_t bs) {
-  for (uint32_t i = 0; i < bs;
-          i += 8, out += 8, in += 8) {
-    MEMCPY128(in, out);
-    MEMCPY128(in + 4, out + 4);
-  }
-}
-
-/* A interface of unpacking functions above */
-typedef void (*vseblocks_unpack_t)(uint32_t *out,
-                                   const uint32_t *in,
-                                   uint32_t bs);
-
-vseblocks_unpack_t VSEBLOCKS_UNPACK[] = {
-  NULL,
-  VSEBLOCKS_UNPACK1,
-  VSEBLOCKS_UNPACK2,
-  VSEBLOCKS_UNPACK3,
-  VSEBLOCKS_UNPACK4,
-  VSEBLOCKS_UNPACK5,
-  VSEBLOCKS_UNPACK6,
-  VSEBLOCKS_UNPACK7,
-  VSEBLOCKS_UNPACK8,
-  VSEBLOCKS_UNPACK9,
-  VSEBLOCKS_UNPACK10,
-  VSEBLOCKS_UNPACK11,
-  VSEBLOCKS_UNPACK12,
-  VSEBLOCKS_UNPACK16,
-  VSEBLOCKS_UNPACK20,
-  VSEBLOCKS_UNPACK32
-};
-
 const uint32_t VSEBLOCKS_LENS[] = {
   1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
   11, 12, 13, 14, 15, 16
@@ -652,7 +46,7 @@ const uint32_t VSEBLOCKS_ZLENS[] = {
   11, 12, 13, 14, 16, 32
 };
 
-const uint32_t VSEBLOCKS_LOGS[] = {
+constexpr uint32_t VSEBLOCKS_LOGS[] = {
   0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
   11, 12, 16, 20, 32
 };
@@ -669,15 +63,39 @@ const uint32_t VSEBLOCKS_CODELOGS[] = {
   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15
 };
 
+/* Add decode costs calibrated at the first use if necessary */
+VSEPartitionConfig ResolveConfig(const VSEPartitionConfig& conf) {
+  return ResolveVSEPartitionConfig(
+      conf, VSEBLOCKS_LENS, VSEBLOCKS_ZLENS,
+      VSEBLOCKS_LENS_LEN, false, VSEBLOCKS_REMAPLOGS,
+      [](std::shared_ptr<VSEncodingPartitioner> p) {
+        return EncodingPtr(new VSEncodingBlocks(p));
+      });
+}
+
 } /* namespace: */
 
 VSEncodingBlocks::VSEncodingBlocks()
     : EncodingBase(E_VSEBLOCKS),
-      wmem_(INITIALIZE_SPTR(
-              uint32_t, VSENCODING_BLOCKSZ * 2 + 128)),
-      vdp_(new VSEncodingDP(VSEBLOCKS_LENS,
-                            VSEBLOCKS_ZLENS,
-                            VSEBLOCKS_LENS_LEN, false)){}
+      vdp_(CreateVSEPartitioner(VSEBLOCKS_LENS,
+                                VSEBLOCKS_ZLENS,
+                                VSEBLOCKS_LENS_LEN, false,
+                                ResolveConfig(GetVSEPartitionConfig()))) {}
+
+VSEncodingBlocks::VSEncodingBlocks(const VSEPartitionConfig& conf)
+    : EncodingBase(E_VSEBLOCKS),
+      vdp_(CreateVSEPartitioner(VSEBLOCKS_LENS,
+                                VSEBLOCKS_ZLENS,
+                                VSEBLOCKS_LENS_LEN, false,
+                                ResolveConfig(conf))) {}
+
+VSEncodingBlocks::VSEncodingBlocks(
+    std::shared_ptr<VSEncodingPartitioner> vdp)
+    : EncodingBase(E_VSEBLOCKS),
+      vdp_(vdp) {
+  if (vdp == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: vdp");
+}
 
 VSEncodingBlocks::~VSEncodingBlocks() throw() {}
 
@@ -777,8 +195,9 @@ void VSEncodingBlocks::encodeVS(const uint32_t *in,
 
   /* Write each bucket ... keeping byte alligment */
   for (uint32_t i = 1; i < VSEBLOCKS_LOGS_LEN; i++) {
-    for (uint32_t j = 0; j < countBlocksLogs[i]; j++)
-      wt.write_bits(blocks[i][j], VSEBLOCKS_LOGS[i]);
+    if (countBlocksLogs[i] > 0)
+      wt.write_fixed_array(&blocks[i][0], countBlocksLogs[i],
+                           VSEBLOCKS_LOGS[i]);
     wt.flush_bits();
   }
 
@@ -875,6 +294,48 @@ inline void CopySubLists(uint32_t offset,
   }
 }
 
+/*
+ * Runs of values that ThreadedDecoder unpacks in advance. A header
+ * has the index of a bit width in the lower VSEBLOCKS_LOGLEN bits
+ * and the # of values in the rest.
+ */
+struct VSEBlocksRunOps {
+  const uint32_t  *in;
+  const uint32_t  *data;
+  uint32_t        *aux;
+  uint32_t        **pblk;
+  int64_t         ntotal;
+  uint32_t        nblk;
+
+  bool more() const {
+    return ntotal > 0;
+  }
+
+  uint32_t next() {
+    uint32_t info = BYTEORDER_FREE_LOAD32(in++);
+    ntotal--;
+    nblk = info >> VSEBLOCKS_LOGLEN;
+    return info & (VSEBLOCKS_LOGS_LEN - 1);
+  }
+
+  template <uint32_t H>
+  FORCE_INLINE void decode() {
+    BitUnpackGroups<BITPACK_MSB, VSEBLOCKS_LOGS[H]>(aux, data, nblk);
+    pblk[H] = aux, aux += nblk;
+    data += DIV_ROUNDUP(nblk * VSEBLOCKS_LOGS[H], 32);
+  }
+};
+
+/*
+ * A working memory of decodeVS() in each thread, because chunks
+ * of ChunkedEncoding are decoded concurrently by a codec.
+ */
+uint32_t *DecodeWorkspace() {
+  static thread_local std::vector<uint32_t> w(
+      VSENCODING_BLOCKSZ * 2 + 128);
+  return w.data();
+}
+
 } /* namespace: */
 
 void VSEncodingBlocks::decodeVS(const uint32_t *in,
@@ -901,22 +362,11 @@ void VSEncodingBlocks::decodeVS(const uint32_t *in,
   ASSERT(data < iterm);
 
   /* Get a working memory */
-  uint32_t *aux = wmem_.get();
-
-  while (LIKELY(ntotal-- > 0)) {
-    uint32_t info = BYTEORDER_FREE_LOAD32(in);
+  uint32_t *aux = DecodeWorkspace();
 
-    uint32_t b = info & (VSEBLOCKS_LOGS_LEN - 1);
-    uint32_t nblk = info >> VSEBLOCKS_LOGLEN;
-
-    /* Do unpacking */
-    VSEBLOCKS_UNPACK[b](aux, data, nblk);
-    pblk[b] = aux, aux += nblk;
-
-    /* Move to next */
-    in++;
-    data += DIV_ROUNDUP(nblk * VSEBLOCKS_LOGS[b], 32);
-  }
+  VSEBlocksRunOps ops = { in, data, aux, pblk, ntotal, 0 };
+  ThreadedDecoder<VSEBlocksRunOps, VSEBLOCKS_LOGS_LEN>::run(&ops);
+  data = ops.data;
 
   while  (LIKELY(out < oterm && data < iterm)) {
     CopySubLists(3, *data, &out, pblk);
@@ -977,6 +427,130 @@ void VSEncodingBlocks::encodeArray(const uint32_t *in,
   *nvalue = ntotal;
 }
 
+void VSEncodingBlocks::appendArray(const uint32_t *in,
+                                   uint64_t len,
+                                   uint64_t num,
+                                   const uint32_t *add,
+                                   uint64_t addlen,
+                                   uint32_t *out,
+                                   uint64_t *nvalue) const {
+  if (in == NULL && num != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (add == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: add");
+  if (addlen == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: addlen");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+
+  if (num == 0) {
+    encodeArray(add, addlen, out, nvalue);
+    return;
+  }
+
+  /* Skip full chunks, and the last one is full if it has no rest */
+  const uint32_t *chunk = in;
+  const uint32_t *iterm = in + len;
+
+  uint64_t nfull = num / VSENCODING_BLOCKSZ;
+  for (uint64_t i = 0; i < nfull; i++) {
+    if (UNLIKELY(chunk >= iterm))
+      THROW_ENCODING_EXCEPTION("Invalid input: in");
+    chunk += BYTEORDER_FREE_LOAD32(chunk) + 1;
+  }
+
+  if (UNLIKELY(chunk > iterm))
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+
+  uint64_t ntail = num - nfull * VSENCODING_BLOCKSZ;
+  REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(ntail + addlen));
+
+  if (ntail != 0)
+    decodeArray(chunk, iterm - chunk, list, ntail);
+  memcpy(list + ntail, add, addlen * sizeof(uint32_t));
+
+  uint64_t nhead = chunk - in;
+  if (*nvalue <= nhead)
+    THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+  uint64_t csize = *nvalue - nhead;
+  encodeArray(list, ntail + addlen, out + nhead, &csize);
+  memcpy(out, in, nhead * sizeof(uint32_t));
+
+  *nvalue = nhead + csize;
+}
+
+void VSEncodingBlocks::encodeArrayParallel(const uint32_t *in,
+                                           uint64_t len,
+                                           uint32_t *out,
+                                           uint64_t *nvalue,
+                                           int nthreads) const {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: in");
+  if (len == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: len");
+  if (out == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: out");
+  if (*nvalue == 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+  if (len > UINT32_MAX || *nvalue > UINT32_MAX)
+    THROW_ENCODING_EXCEPTION(
+        "VSEncodingBlocks only supports 32-bit length");
+
+  ASSERT_ADDR(in, len);
+  ASSERT_ADDR(out, *nvalue);
+
+  if (nthreads <= 0)
+    nthreads = omp_get_max_threads();
+
+  /* Chunks are split as encodeArray() does */
+  int64_t nchunks = DIV_ROUNDUP(len, VSENCODING_BLOCKSZ);
+  std::vector<std::vector<uint32_t> > chunks(nchunks);
+  std::exception_ptr err;
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    std::vector<uint32_t> buf(VSENCODING_BLOCKSZ * 2 + 128);
+
+#pragma omp for schedule(dynamic)
+    for (int64_t i = 0; i < nchunks; i++) {
+      uint64_t off = i * VSENCODING_BLOCKSZ;
+      uint32_t n = (len - off < VSENCODING_BLOCKSZ)?
+          len - off : VSENCODING_BLOCKSZ;
+      uint32_t csize = buf.size();
+
+      try {
+        encodeVS(in + off, n, buf.data(), &csize);
+        chunks[i].assign(buf.begin(), buf.begin() + csize);
+      } catch (...) {
+#pragma omp critical
+        if (!err)
+          err = std::current_exception();
+      }
+    }
+  }
+
+  if (err)
+    std::rethrow_exception(err);
+
+  /* Stitch chunks with a prefix sum over their sizes */
+  std::vector<uint64_t> offs(nchunks + 1, 0);
+  for (int64_t i = 0; i < nchunks; i++)
+    offs[i + 1] = offs[i] + chunks[i].size() + 1;
+
+  if (offs[nchunks] > *nvalue)
+    THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+#pragma omp parallel for num_threads(nthreads)
+  for (int64_t i = 0; i < nchunks; i++) {
+    BYTEORDER_FREE_STORE32(out + offs[i],
+                           static_cast<uint32_t>(chunks[i].size()));
+    std::copy(chunks[i].begin(), chunks[i].end(), out + offs[i] + 1);
+  }
+
+  *nvalue = offs[nchunks];
+}
+
 void VSEncodingBlocks::decodeArray(const uint32_t *in,
                                    uint64_t len,
                                    uint32_t *out,
@@ -999,10 +573,16 @@ void VSEncodingBlocks::decodeArray(const uint32_t *in,
   uint32_t res = static_cast<uint32_t>(nvalue);
 
   const uint32_t *iterm = in + len;
+  const uint64_t dist = GetPrefetchConfig().blocks;
 
   while (LIKELY(res > VSENCODING_BLOCKSZ &&
                 in < iterm)) {
     uint32_t sum = BYTEORDER_FREE_LOAD32(in);
+
+    /* Chunks ahead are located by the size of this one */
+    if (dist != 0)
+      PrefetchBytes(in + dist * (sum + 1), (sum + 1) * 4);
+
     decodeVS(in + 1, sum, out, VSENCODING_BLOCKSZ);
     in += sum + 1;
     out += VSENCODING_BLOCKSZ;
@@ -15,6 +15,7 @@
  */
 
 #include <compress/policy/VSEncodingDP.hpp>
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
 #include<unistd.h>
@@ -24,146 +25,123 @@ namespace internals {
 
 VSEncodingDP::VSEncodingDP(const uint32_t *lens, const uint32_t *zlens,
 		uint32_t size, bool aligned) :
-		aligned_(aligned), size_(size), mxblk_(lens[size - 1]), lens_(lens), zlens_(
-				zlens) {
-	if (lens == NULL)
-		THROW_ENCODING_EXCEPTION("Invalid value: lens");
-	if (size == 0)
-		THROW_ENCODING_EXCEPTION("Invalid value: size");
-
-	ASSERT_ADDR(lens, size);
-
-	/* Set the max length of sequences */
-	if (zlens != NULL && mxblk_ < zlens[size - 1])
-		mxblk_ = zlens[size - 1];
+		VSEncodingPartitioner(lens, zlens, size, aligned) {
 }
 
 VSEncodingDP::~VSEncodingDP() throw () {
 }
 
+namespace {
+
+/* Workspaces reused over calls in a thread */
+struct DPWorkspace {
+	std::vector<int64_t> sssp;
+	std::vector<uint64_t> costs;
+	VSERangeMax rmq;
+
+	DPWorkspace() :
+			sssp(), costs(), rmq() {
+	}
+};
+
+DPWorkspace& workspace() {
+	static thread_local DPWorkspace w;
+	return w;
+}
+
+} /* namespace: */
+
 void VSEncodingDP::computePartition(const std::vector<uint32_t>& seq,
 		std::vector<uint32_t> *parts, uint32_t fixedCost) const {
 	ASSERT(seq.size() != 0);
 	ASSERT(parts != NULL);
 
+	uint64_t n = seq.size();
+	DPWorkspace& w = workspace();
+
 	/*
 	 * costs[i] will contain the cost of
 	 * encoding up to i-th position.
 	 */
-	std::vector<int32_t> sssp;
-	std::vector<uint32_t> costs;
+	w.sssp.resize(n + 1);
+	w.costs.resize(n + 1);
+	w.sssp[0] = -1;
+	w.costs[0] = 0;
 
-	for (uint64_t i = 0; i <= seq.size(); i++)
-		sssp.push_back(-1);
-	for (uint64_t i = 0; i <= seq.size(); i++)
-		costs.push_back(0);
+	/* Build a sparse table for range-max queries of block logs */
+	w.rmq.build(seq, levels_);
 
-	ASSERT(sssp.size() == seq.size() + 1);
-	ASSERT(costs.size() == seq.size() + 1);
-
-	FILE* stat = fopen("./share/dploops", "a");
 	{
 		/*
-		 * NOTE: This loop computes the cost of the optimal
-		 * partition. The computation of the max log in each
-		 * block is done by scanning. Probably we could
-		 * obtain a faster solution by using RMQ data structures.
-		 * We use this trivial solution since construction
-		 * time is not our main concern.
+		 * NOTE: Only admissible lengths in lens_[] and zlens_[]
+		 * are visited for each i, and the max log in a block
+		 * is given by the sparse table in O(1). Ties are broken
+		 * toward longer blocks, which gives the same partitions
+		 * as scanning every j from i - 1 down did.
 		 */
-		uint32_t maxB;
-		int64_t j, g, l, mleft;
-		uint64_t ccost;
-		//XXX 1 in 3
 		int ind = 0;
-
-// i每前进1，一个元素进入到划分中，内循环开始考虑在之前所有划分代价
-// 已知的情况下，如何把新元素和原来的划分集合形成新的最优划分
-// 注意新划分长度不能超过mxblk_
-		for (uint64_t i = 1; i <= seq.size(); i++) {
-			mleft = (i > mxblk_) ? i - mxblk_ : 0;
-
-			//l表示k取值数组的索引，g与zlens相关
-			for (maxB = 0, l = 0, g = 0, j = i - 1; j >= mleft; j--) {
-				//XXX 2 in 3
-				ind++;
-				ASSERT(l <= size_);
-				ASSERT(g <= size_);
-
-				if (maxB < seq[j])
-					maxB = seq[j];
-
-				if (zlens_ == NULL) {
-					/*
-					 * FIXME: If the gaps of elements in lens_[]
-					 * are sparse, a process below is more efficient
-					 * to hop these gaps using the elements rather
-					 * than decrementing j.
-					 */
-					//在这里，限定了k只能取lens数组内的值
-					if (i - j != lens_[l])
-						continue;
-					else
-						l++;
-				} else {
-					/*
-					 * Treat runs of 0 in a different way.
-					 * They could form larger blocks!
-					 */
-					if (maxB != 0) {
-						mleft = (i > mxblk_) ? i - lens_[size_ - 1] : 0;
-						if (i - j != lens_[l])
-							continue;
-						else
-							l++;
-					} else {
-						if (i - j == lens_[l])
-							l++;
-						if (i - j != zlens_[g])
-							continue;
-						else
-							g++;
-					}
+		uint64_t zrun = 0;
+
+		for (uint64_t i = 1; i <= n; i++) {
+			uint64_t best = UINT64_MAX;
+			int64_t bestj = -1;
+
+			/* Length of the run of 0 that ends at i - 1 */
+			zrun = (seq[i - 1] == 0) ? zrun + 1 : 0;
+
+			auto relax = [&](uint64_t len, uint32_t maxB) {
+				uint64_t j = i - len;
+				uint64_t ccost = w.costs[j] + blockCost(len, maxB, fixedCost);
+				if (ccost < best || (ccost == best &&
+						static_cast<int64_t>(j) < bestj)) {
+					best = ccost;
+					bestj = j;
 				}
+				ind++;
+			};
 
-				/* Caluculate costs */
-				if (aligned_)
-					ccost = costs[j] + DIV_ROUNDUP((i - j) * maxB, 32)
-							+ fixedCost;
-				else
-					ccost = costs[j] + (i - j) * maxB + fixedCost;
+			for (uint32_t l = 0; l < size_ && lens_[l] <= i; l++) {
+				uint64_t len = lens_[l];
 
-				if (sssp[i] == -1)
-					costs[i] = ccost + 1;
+				/*
+				 * Treat runs of 0 in a different way.
+				 * They could form larger blocks!
+				 */
+				if (zlens_ != NULL && len <= zrun)
+					continue;
 
-				/* If necessary, update the cost */
-				if (ccost <= costs[i]) {
-					costs[i] = ccost;
-					sssp[i] = j;
-				}
+				relax(len, w.rmq.query(i - len, len));
 			}
+
+			if (zlens_ != NULL) {
+				for (uint32_t g = 0;
+						g < size_ && zlens_[g] <= zrun; g++)
+					relax(zlens_[g], 0);
+			}
+
+			ASSERT(bestj >= 0);
+			w.costs[i] = best;
+			w.sssp[i] = bestj;
 		}
-		//XXX 3 in 3
-//		std::cout << "times of loop: " << ind << std::endl;
-		fwrite(&ind, 4, 1, stat);
-		fflush(stat);
-		fclose(stat);
+
+		ENCODING_STAT(STAT_VSEDP_LOOPS, ind);
 	}
+
 	/* Compute number of nodes in the path */
 	uint64_t idx = 0;
-	uint64_t next = seq.size();
+	uint64_t next = n;
 	while (next != 0) {
-		next = sssp[next];
+		next = w.sssp[next];
 		idx++;
 	}
+	ENCODING_STAT(STAT_VSE_PARTS, idx);
 
 	/* Obtain the optimal partition */
-	for (uint64_t i = 0; i <= idx; i++)
-		parts->push_back(0);
-	next = seq.size();
+	parts->assign(idx + 1, 0);
+	next = n;
 	while (next != 0) {
 		(*parts)[idx--] = next;
-		next = sssp[next];
+		next = w.sssp[next];
 	}
 }
 
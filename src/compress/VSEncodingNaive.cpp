@@ -21,20 +21,6 @@ namespace internals {
 
 namespace {
 
-const uint32_t VSENAIVE_LOGLEN = 3;
-const uint32_t VSENAIVE_LOGLOG = 3;
-// 这个3是有问题的，因为b的取值范围是2^4个
-// 但naive的作用只是处理VSE-R的bit位数，故3足够了
-
-const uint32_t VSENAIVE_LENS_LEN = 1U << VSENAIVE_LOGLEN;
-
-// lens则存储了k所能取得的值
-const uint32_t VSENAIVE_LENS[] = { 1, 2, 4, 6, 8, 16, 32, 64 };
-
-// 这里的logs和remaplogs存储了b所能取得的值，即从13开始，向4的整数倍重映射
-const uint32_t VSENAIVE_LOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 16,
-		20, 32 };
-
 const uint32_t VSENAIVE_REMAPLOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
 		12, 16, 16, 16, 16, 20, 20, 20, 20, 32, 32, 32, 32, 32, 32, 32, 32, 32,
 		32, 32, 32 };
@@ -51,8 +37,13 @@ const uint32_t VSENAIVE_CODELOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
 } /* namespace: */
 
 VSEncodingNaive::VSEncodingNaive() :
-		EncodingBase(E_INVALID), vdp_(new VSEncodingDP(VSENAIVE_LENS,
-		NULL, ARRAYSIZE(VSENAIVE_LENS), false)) {
+		EncodingBase(E_INVALID), vdp_(CreateVSEPartitioner(VSENAIVE_LENS,
+		NULL, ARRAYSIZE(VSENAIVE_LENS), false, GetVSEPartitionConfig())) {
+}
+
+VSEncodingNaive::VSEncodingNaive(const VSEPartitionConfig& conf) :
+		EncodingBase(E_INVALID), vdp_(CreateVSEPartitioner(VSENAIVE_LENS,
+		NULL, ARRAYSIZE(VSENAIVE_LENS), false, conf)) {
 }
 
 VSEncodingNaive::~VSEncodingNaive() throw () {
@@ -114,8 +105,8 @@ void VSEncodingNaive::encodeArray(const uint32_t *in, uint64_t len,
 		/* Write the value of B*/
 		wt.write_bits(VSENAIVE_CODELOGS[bParts[i]], VSENAIVE_LOGLOG);
 		/* Write integers */
-		for (uint64_t j = parts[i]; j < parts[i + 1]; j++)
-			wt.write_bits(in[j], bParts[i]);
+		wt.write_fixed_array(&in[parts[i]], parts[i + 1] - parts[i],
+				bParts[i]);
 	}
 
 	wt.flush_bits();
@@ -149,8 +140,7 @@ void VSEncodingNaive::encodeArray(const uint32_t *in, uint64_t len,
 		wt.write_bits(VSENAIVE_CODELENS[parts[i + 1] - parts[i]],
 				VSENAIVE_LOGLEN);
 		/* Write integers */
-		for (uint64_t j = parts[i]; j < parts[i + 1]; j++)
-		wt.write_bits(in[j], maxB);
+		wt.write_fixed_array(&in[parts[i]], parts[i + 1] - parts[i], maxB);
 	}
 
 	wt.flush_bits();
@@ -186,10 +176,6 @@ void VSEncodingNaive::decodeArray(const uint32_t *in, uint64_t len,
 //	uint32_t Ks[leng];
 	uint32_t* Ks = (uint32_t*) malloc(leng * 4);
 	simp.decodeArray(in + 2, cmpSize, Ks, nvalue);
-	FILE* stat = fopen("./share/vserOPstatistics", "a");
-	fwrite(Ks, 4, leng, stat);//每个分块长度
-	fflush(stat);
-	fclose(stat);
 //
 //	memcpy(Ks, out, leng * 4);
 	in += cmpSize + 2;
@@ -200,6 +186,7 @@ void VSEncodingNaive::decodeArray(const uint32_t *in, uint64_t len,
 	while (LIKELY(out < oterm)) {
 		uint32_t B = VSENAIVE_LOGS[rd.read_bits(VSENAIVE_LOGLOG)];
 
+		ENCODING_STAT(STAT_VSENAIVE_BLOCKLEN, Ks[i]);
 		for (uint32_t j = 0; j < Ks[i]; j++) {
 			out[j] = (B != 0) ? rd.read_bits(B) : 0;
 //			std::cout << count++ << ":" << out[j] << std::endl;
@@ -210,21 +197,18 @@ void VSEncodingNaive::decodeArray(const uint32_t *in, uint64_t len,
 #else
 
 	BitsReader rd(in, len);
-	FILE* stat = fopen("./share/vserDPstatistics", "a");
 
 	while (LIKELY(out < oterm)) {
 		uint32_t B = VSENAIVE_LOGS[rd.read_bits(VSENAIVE_LOGLOG)];
 		uint32_t K = VSENAIVE_LENS[rd.read_bits(VSENAIVE_LOGLEN)];
 
-		fwrite(&K, 4, 1, stat);
+		ENCODING_STAT(STAT_VSENAIVE_BLOCKLEN, K);
 		for (uint32_t i = 0; i < K; i++) {
 			out[i] = (B != 0) ? rd.read_bits(B) : 0;
 //		printf("out[%d]:%d\cmpSize",i,out[i]);
 		}
 		out += K;
 	}
-	fflush(stat);
-	fclose(stat);
 #endif
 }
 
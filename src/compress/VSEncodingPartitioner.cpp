@@ -0,0 +1,465 @@
+/*-----------------------------------------------------------------------------
+ *  VSEncodingPartitioner.cpp - Strategies to partition a list for VSEncoding
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <compress/policy/VSEncodingPartitioner.hpp>
+#include <compress/policy/VSEncodingDP.hpp>
+#include <compress/policy/VSEncodingOP.hpp>
+
+#include <chrono>
+#include <mutex>
+
+namespace integer_encoding {
+namespace internals {
+
+VSEDecodeCost::VSEDecodeCost() {
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++)
+    for (uint32_t k = 0; k < VSE_MAX_LENS; k++)
+      ns_[b][k] = 0.0;
+}
+
+bool VSEDecodeCost::load(const char *path) {
+  if (path == NULL)
+    return false;
+
+  FILE *fp = fopen(path, "r");
+  if (fp == NULL)
+    return false;
+
+  unsigned int b = 0;
+  unsigned int k = 0;
+  double ns = 0.0;
+  bool ok = true;
+
+  while (ok) {
+    int ret = fscanf(fp, "%u %u %lf", &b, &k, &ns);
+    if (ret == EOF)
+      break;
+    ok = (ret == 3 && b < VSE_MAX_LOGS && k < VSE_MAX_LENS && ns >= 0.0);
+    if (ok)
+      ns_[b][k] = ns;
+  }
+
+  fclose(fp);
+  return ok;
+}
+
+bool VSEDecodeCost::save(const char *path) const {
+  if (path == NULL)
+    return false;
+
+  FILE *fp = fopen(path, "w");
+  if (fp == NULL)
+    return false;
+
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++)
+    for (uint32_t k = 0; k < VSE_MAX_LENS; k++)
+      fprintf(fp, "%u %u %.4f\n", b, k, ns_[b][k]);
+
+  return fclose(fp) == 0;
+}
+
+void VSERangeMax::build(const std::vector<uint32_t>& seq,
+                        uint32_t levels) {
+  ASSERT(levels <= VSEDP_RMQ_LEVELS);
+
+  /* rmq_[k][j] keeps the max of seq[j, j + 2^k) */
+  rmq_[0].assign(seq.begin(), seq.end());
+  for (uint32_t k = 1; k < levels; k++) {
+    const std::vector<uint32_t>& prev = rmq_[k - 1];
+    std::vector<uint32_t>& cur = rmq_[k];
+    uint64_t h = uint64_t(1) << (k - 1);
+
+    cur.resize(seq.size());
+    for (uint64_t j = 0; j + 2 * h <= seq.size(); j++)
+      cur[j] = (prev[j] < prev[j + h])? prev[j + h] : prev[j];
+  }
+}
+
+VSEncodingPartitioner::VSEncodingPartitioner(const uint32_t *lens,
+                                             const uint32_t *zlens,
+                                             uint32_t size,
+                                             bool aligned)
+    : aligned_(aligned), size_(size), mxblk_(0),
+      levels_(0), lens_(lens), zlens_(zlens), tcost_() {
+  if (lens == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: lens");
+  if (size == 0)
+    THROW_ENCODING_EXCEPTION("Invalid value: size");
+
+  ASSERT_ADDR(lens, size);
+
+  /* Set the max length of sequences */
+  mxblk_ = lens[size - 1];
+  if (zlens != NULL && mxblk_ < zlens[size - 1])
+    mxblk_ = zlens[size - 1];
+
+  /* Levels of the sparse table to cover the longest block */
+  levels_ = 32 - MSB32(mxblk_);
+  if (levels_ > VSEDP_RMQ_LEVELS)
+    THROW_ENCODING_EXCEPTION("Invalid value: lens");
+}
+
+VSEncodingPartitioner::~VSEncodingPartitioner() throw() {}
+
+void VSEncodingPartitioner::setDecodeCost(const VSEDecodeCost& dcost,
+                                          double lambda) {
+  if (!(lambda >= 0.0))
+    THROW_ENCODING_EXCEPTION("Invalid value: lambda");
+  if (size_ > VSE_MAX_LENS)
+    THROW_ENCODING_EXCEPTION("Invalid value: size");
+
+  tcost_.assign(VSE_MAX_LOGS * (mxblk_ + 1), 0);
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++) {
+    for (uint32_t k = 0; k < size_; k++) {
+      uint32_t len = (b == 0 && zlens_ != NULL)? zlens_[k] : lens_[k];
+      tcost_[b * (mxblk_ + 1) + len] =
+          static_cast<uint32_t>(lambda * dcost.get(b, k) + 0.5);
+    }
+  }
+}
+
+namespace {
+
+/* Workspaces reused over calls in a thread */
+struct PartWorkspace {
+  VSERangeMax rmq;
+
+  PartWorkspace() : rmq() {}
+};
+
+PartWorkspace& workspace() {
+  static thread_local PartWorkspace w;
+  return w;
+}
+
+/* Cut blocks of the k-th length to measure decode costs */
+class VSEncodingFixed : public VSEncodingPartitioner {
+ public:
+  explicit VSEncodingFixed(const uint32_t *lens, const uint32_t *zlens,
+                           uint32_t size, bool aligned, uint32_t k)
+      : VSEncodingPartitioner(lens, zlens, size, aligned), k_(k) {}
+  ~VSEncodingFixed() throw() {}
+
+  void computePartition(const std::vector<uint32_t>& seq,
+                        std::vector<uint32_t> *parts,
+                        uint32_t cost) const {
+    parts->assign(1, 0);
+
+    /* Lists are made of only 0 or no 0 */
+    const uint32_t *t = (zlens_ != NULL && seq[0] == 0)? zlens_ : lens_;
+
+    for (uint64_t i = 0, k = k_; i < seq.size(); ) {
+      while (k > 0 && i + t[k] > seq.size())
+        k--;
+      i += t[k];
+      parts->push_back(i);
+    }
+  }
+
+ private:
+  uint32_t k_;
+};
+
+} /* namespace: */
+
+VSEncodingApprox::VSEncodingApprox(const uint32_t *lens,
+                                   const uint32_t *zlens,
+                                   uint32_t size, bool aligned,
+                                   double eps1, double eps2)
+    : VSEncodingPartitioner(lens, zlens, size, aligned),
+      eps1_(eps1), eps2_(eps2) {
+  if (!(eps1 > 0.0 && eps1 < 1.0))
+    THROW_ENCODING_EXCEPTION("Invalid value: eps1");
+  if (!(eps2 > 0.0))
+    THROW_ENCODING_EXCEPTION("Invalid value: eps2");
+}
+
+VSEncodingApprox::~VSEncodingApprox() throw() {}
+
+void VSEncodingApprox::computePartition(const std::vector<uint32_t>& seq,
+                                        std::vector<uint32_t> *parts,
+                                        uint32_t fixedCost) const {
+  ASSERT(seq.size() != 0);
+  ASSERT(parts != NULL);
+
+  PartWorkspace& w = workspace();
+  w.rmq.build(seq, levels_);
+
+  optimal_partition op(seq, lens_, zlens_, size_, fixedCost, eps1_, eps2_,
+      [&](uint64_t i, uint64_t len) {
+        return blockCost(len, w.rmq.query(i, len), fixedCost);
+      });
+
+  parts->assign(op.partition.begin(), op.partition.end());
+}
+
+VSEncodingGreedy::VSEncodingGreedy(const uint32_t *lens,
+                                   const uint32_t *zlens,
+                                   uint32_t size, bool aligned)
+    : VSEncodingPartitioner(lens, zlens, size, aligned) {}
+
+VSEncodingGreedy::~VSEncodingGreedy() throw() {}
+
+void VSEncodingGreedy::computePartition(const std::vector<uint32_t>& seq,
+                                        std::vector<uint32_t> *parts,
+                                        uint32_t fixedCost) const {
+  ASSERT(seq.size() != 0);
+  ASSERT(parts != NULL);
+
+  uint64_t n = seq.size();
+
+  parts->clear();
+  parts->push_back(0);
+
+  for (uint64_t i = 0; i < n; ) {
+    uint64_t z = 0;
+
+    /* Cut the longest run of 0 that zlens_[] allows */
+    if (zlens_ != NULL) {
+      while (i + z < n && z < mxblk_ && seq[i + z] == 0)
+        z++;
+
+      uint32_t g = 0;
+      while (g < size_ && zlens_[g] <= z)
+        g++;
+      if (g > 0) {
+        i += zlens_[g - 1];
+        parts->push_back(i);
+        continue;
+      }
+    }
+
+    /*
+     * Take the block with the smallest cost per integer, and
+     * ties are broken toward longer blocks. The max log is
+     * extended over the integers that each length adds.
+     */
+    uint64_t bestLen = 0;
+    uint64_t bestCost = 0;
+    uint64_t end = i;
+    uint32_t maxB = 0;
+
+    for (uint32_t l = 0; l < size_ && i + lens_[l] <= n; l++) {
+      uint64_t len = lens_[l];
+      for (; end < i + len; end++)
+        maxB = (maxB < seq[end])? seq[end] : maxB;
+
+      /* Blocks of 0 must be taken by zlens_[] */
+      if (len <= z)
+        continue;
+
+      uint64_t c = blockCost(len, maxB, fixedCost);
+      if (bestLen == 0 || c * bestLen <= bestCost * len) {
+        bestLen = len;
+        bestCost = c;
+      }
+    }
+
+    if (UNLIKELY(bestLen == 0))
+      THROW_ENCODING_EXCEPTION("Not partitioned: lens");
+
+    i += bestLen;
+    parts->push_back(i);
+  }
+}
+
+bool ParseVSEPartitionConfig(const char *str, VSEPartitionConfig *conf) {
+  if (str == NULL || conf == NULL)
+    return false;
+
+  if (strcmp(str, "exact") == 0) {
+    *conf = VSEPartitionConfig(VSE_PARTITION_EXACT);
+    return true;
+  }
+
+  if (strcmp(str, "greedy") == 0) {
+    *conf = VSEPartitionConfig(VSE_PARTITION_GREEDY);
+    return true;
+  }
+
+  if (strncmp(str, "approx", 6) == 0) {
+    VSEPartitionConfig c(VSE_PARTITION_APPROX);
+    const char *p = str + 6;
+
+    if (*p == ':') {
+      char *e = NULL;
+      c.eps1 = strtod(p + 1, &e);
+      if (e == p + 1 || *e != ':')
+        return false;
+      p = e;
+      c.eps2 = strtod(p + 1, &e);
+      if (e == p + 1)
+        return false;
+      p = e;
+    }
+
+    if (*p != '\0' || !(c.eps1 > 0.0 && c.eps1 < 1.0) || !(c.eps2 > 0.0))
+      return false;
+
+    *conf = c;
+    return true;
+  }
+
+  return false;
+}
+
+namespace {
+
+VSEPartitionConfig& defaultConfig() {
+  /* Loaded once even if codecs are created in several threads */
+  static VSEPartitionConfig conf = [] {
+    VSEPartitionConfig c;
+    ParseVSEPartitionConfig(getenv(VSE_PARTITION_ENV), &c);
+
+    const char *lambda = getenv(VSE_LAMBDA_ENV);
+    if (lambda != NULL && atof(lambda) > 0.0)
+      c.lambda = atof(lambda);
+
+    std::shared_ptr<VSEDecodeCost> dcost(new VSEDecodeCost());
+    if (dcost->load(getenv(VSE_DCOST_ENV)))
+      c.dcost = dcost;
+
+    return c;
+  }();
+
+  return conf;
+}
+
+} /* namespace: */
+
+const VSEPartitionConfig& GetVSEPartitionConfig() {
+  return defaultConfig();
+}
+
+void SetVSEPartitionConfig(const VSEPartitionConfig& conf) {
+  defaultConfig() = conf;
+}
+
+std::shared_ptr<VSEncodingPartitioner> CreateVSEPartitioner(
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned, const VSEPartitionConfig& conf) {
+  std::shared_ptr<VSEncodingPartitioner> p;
+
+  switch (conf.policy) {
+    case VSE_PARTITION_EXACT:
+      p.reset(new VSEncodingDP(lens, zlens, size, aligned));
+      break;
+    case VSE_PARTITION_APPROX:
+      p.reset(new VSEncodingApprox(lens, zlens, size, aligned,
+                                   conf.eps1, conf.eps2));
+      break;
+    case VSE_PARTITION_GREEDY:
+      p.reset(new VSEncodingGreedy(lens, zlens, size, aligned));
+      break;
+    default:
+      THROW_ENCODING_EXCEPTION("Invalid value: policy");
+  }
+
+  if (conf.lambda > 0.0 && conf.dcost != NULL)
+    p->setDecodeCost(*conf.dcost, conf.lambda);
+
+  return p;
+}
+
+std::shared_ptr<const VSEDecodeCost> CalibrateVSEDecodeCost(
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned,
+    const uint32_t *remaplogs, const VSECodecCreator& create) {
+  if (lens == NULL || remaplogs == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: lens");
+  if (size == 0 || size > VSE_MAX_LENS)
+    THROW_ENCODING_EXCEPTION("Invalid value: size");
+
+  /* # of integers and rounds to decode for each entry */
+  const uint32_t NUM = 4096;
+  const uint32_t ROUNDS = 5;
+
+  std::shared_ptr<VSEDecodeCost> dcost(new VSEDecodeCost());
+
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++) {
+    /* Widths that a codec never uses take the costs of remapped ones */
+    if (remaplogs[b] != b)
+      continue;
+
+    for (uint32_t k = 0; k < size; k++) {
+      uint32_t len = (b == 0 && zlens != NULL)? zlens[k] : lens[k];
+      uint32_t n = (NUM / len) * len;
+      if (n == 0)
+        n = len;
+
+      std::vector<uint32_t> data(n);
+      for (uint32_t i = 0; i < n; i++)
+        data[i] = (b == 0)? 0 :
+            (1U << (b - 1)) | (xor128() & ((1U << (b - 1)) - 1));
+
+      EncodingPtr c = create(std::shared_ptr<VSEncodingPartitioner>(
+          new VSEncodingFixed(lens, zlens, size, aligned, k)));
+
+      /* Blocks of 1 integer can exceed require() in some codecs */
+      uint64_t nvalue = 2 * c->require(n) + 128;
+      std::vector<uint32_t> out(nvalue);
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(n));
+      c->encodeArray(data.data(), n, out.data(), &nvalue);
+
+      /* Take the fastest round to filter out noises */
+      double best = 0.0;
+      for (uint32_t r = 0; r < ROUNDS; r++) {
+        std::chrono::steady_clock::time_point t =
+            std::chrono::steady_clock::now();
+        c->decodeArray(out.data(), nvalue, dec.data(), n);
+        double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - t).count();
+        if (r == 0 || ns < best)
+          best = ns;
+      }
+
+      dcost->set(b, k, best / (n / len));
+    }
+  }
+
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++)
+    for (uint32_t k = 0; k < size; k++)
+      dcost->set(b, k, dcost->get(remaplogs[b], k));
+
+  return dcost;
+}
+
+VSEPartitionConfig ResolveVSEPartitionConfig(
+    const VSEPartitionConfig& conf,
+    const uint32_t *lens, const uint32_t *zlens,
+    uint32_t size, bool aligned,
+    const uint32_t *remaplogs, const VSECodecCreator& create) {
+  VSEPartitionConfig c(conf);
+  if (!(c.lambda > 0.0) || c.dcost != NULL)
+    return c;
+
+  /* Costs are calibrated once for each codec, told apart by lens */
+  static std::mutex lock;
+  static std::map<const uint32_t *,
+                  std::shared_ptr<const VSEDecodeCost> > costs;
+
+  std::lock_guard<std::mutex> guard(lock);
+  std::shared_ptr<const VSEDecodeCost>& dcost = costs[lens];
+  if (dcost == NULL)
+    dcost = CalibrateVSEDecodeCost(lens, zlens, size, aligned,
+                                   remaplogs, create);
+
+  c.dcost = dcost;
+  return c;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
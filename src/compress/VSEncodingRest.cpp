@@ -30,61 +30,71 @@ const uint32_t VSEREST_LENS_LEN = 1U << VSEREST_LOGLEN;
 const uint32_t VSEREST_LOGS_LEN = 1U << VSEREST_LOGLOG;
 const uint32_t VSEREST_LEN = 1U << VSEREST_LOGDESC;
 
+/*
+ * Paddings that unpackers leave in the last word of a block, and
+ * the next block restores a word from them. They live on a stack
+ * of decodeArray() so that any input is never rewritten.
+ */
+struct vserest_state_t {
+	uint32_t fill;
+	uint64_t buf;
+};
+
 /* Unpacker: 0 */
 inline void VSEREST_UNPACK0_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	*out += 1;
 }
 
 inline void VSEREST_UNPACK0_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	*out += 2;
 }
 
 inline void VSEREST_UNPACK0_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	*out += 3;
 }
 
 inline void VSEREST_UNPACK0_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	*out += 4;
 }
 
 inline void VSEREST_UNPACK0_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	*out += 5;
 }
 
 inline void VSEREST_UNPACK0_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	*out += 6;
 }
 
 inline void VSEREST_UNPACK0_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	*out += 7;
 }
 
 inline void VSEREST_UNPACK0_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	*out += 8;
 }
 
 inline void VSEREST_UNPACK0_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -92,7 +102,7 @@ inline void VSEREST_UNPACK0_9(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -100,7 +110,7 @@ inline void VSEREST_UNPACK0_10(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -108,7 +118,7 @@ inline void VSEREST_UNPACK0_11(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -116,7 +126,7 @@ inline void VSEREST_UNPACK0_12(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
@@ -126,7 +136,7 @@ inline void VSEREST_UNPACK0_14(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -135,7 +145,7 @@ inline void VSEREST_UNPACK0_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
@@ -149,7 +159,7 @@ inline void VSEREST_UNPACK0_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK0_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	ZMEMCPY128(*out);
 	ZMEMCPY128(*out + 4);
 	ZMEMCPY128(*out + 8);
@@ -178,58 +188,54 @@ namespace {
       __fill__ += __bit__;    \
     })
 
-/* FIXME: Need to fix in a thread-safe way */
-uint32_t number_of_filled_bits;
-uint64_t buffer_data;
-
 } /* namespace: */
 
 /* UNPACKER: 1 */
 inline void VSEREST_UNPACK1_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 
-	VSEREST_PUSH_BUF(val, 31, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 31, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK1_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 30, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 30, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK1_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
 	(*out)[2] = (val >> 29) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK1_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
 	(*out)[2] = (val >> 29) & 0x01;
 	(*out)[3] = (val >> 28) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK1_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -237,12 +243,12 @@ inline void VSEREST_UNPACK1_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 28) & 0x01;
 	(*out)[4] = (val >> 27) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 27, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 27, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK1_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -251,12 +257,12 @@ inline void VSEREST_UNPACK1_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 27) & 0x01;
 	(*out)[5] = (val >> 26) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 1, *out += 6;
 }
 
 inline void VSEREST_UNPACK1_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -266,12 +272,12 @@ inline void VSEREST_UNPACK1_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 26) & 0x01;
 	(*out)[6] = (val >> 25) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 25, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 25, st->fill, st->buf);
 	*in += 1, *out += 7;
 }
 
 inline void VSEREST_UNPACK1_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -282,12 +288,12 @@ inline void VSEREST_UNPACK1_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 25) & 0x01;
 	(*out)[7] = (val >> 24) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 1, *out += 8;
 }
 
 inline void VSEREST_UNPACK1_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -299,12 +305,12 @@ inline void VSEREST_UNPACK1_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 24) & 0x01;
 	(*out)[8] = (val >> 23) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 23, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 23, st->fill, st->buf);
 	*in += 1, *out += 9;
 }
 
 inline void VSEREST_UNPACK1_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -317,12 +323,12 @@ inline void VSEREST_UNPACK1_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 23) & 0x01;
 	(*out)[9] = (val >> 22) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 1, *out += 10;
 }
 
 inline void VSEREST_UNPACK1_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -336,12 +342,12 @@ inline void VSEREST_UNPACK1_11(uint32_t ** restrict out,
 	(*out)[9] = (val >> 22) & 0x01;
 	(*out)[10] = (val >> 21) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 21, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 21, st->fill, st->buf);
 	*in += 1, *out += 11;
 }
 
 inline void VSEREST_UNPACK1_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -356,12 +362,12 @@ inline void VSEREST_UNPACK1_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 21) & 0x01;
 	(*out)[11] = (val >> 20) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 12;
 }
 
 inline void VSEREST_UNPACK1_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -378,12 +384,12 @@ inline void VSEREST_UNPACK1_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 19) & 0x01;
 	(*out)[13] = (val >> 18) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 18, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 18, st->fill, st->buf);
 	*in += 1, *out += 14;
 }
 
 inline void VSEREST_UNPACK1_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -402,12 +408,12 @@ inline void VSEREST_UNPACK1_16(uint32_t ** restrict out,
 	(*out)[14] = (val >> 17) & 0x01;
 	(*out)[15] = (val >> 16) & 0x01;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 16;
 }
 
 inline void VSEREST_UNPACK1_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 31;
 	(*out)[1] = (val >> 30) & 0x01;
@@ -446,7 +452,7 @@ inline void VSEREST_UNPACK1_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK1_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 31;
@@ -486,50 +492,50 @@ inline void VSEREST_UNPACK1_64(uint32_t ** restrict out,
 
 /* UNPACKER: 2 */
 inline void VSEREST_UNPACK2_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 
-	VSEREST_PUSH_BUF(val, 30, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 30, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK2_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK2_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
 	(*out)[2] = (val >> 26) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK2_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
 	(*out)[2] = (val >> 26) & 0x03;
 	(*out)[3] = (val >> 24) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK2_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -537,12 +543,12 @@ inline void VSEREST_UNPACK2_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 24) & 0x03;
 	(*out)[4] = (val >> 22) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK2_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -551,12 +557,12 @@ inline void VSEREST_UNPACK2_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 22) & 0x03;
 	(*out)[5] = (val >> 20) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 6;
 }
 
 inline void VSEREST_UNPACK2_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -566,12 +572,12 @@ inline void VSEREST_UNPACK2_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 20) & 0x03;
 	(*out)[6] = (val >> 18) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 18, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 18, st->fill, st->buf);
 	*in += 1, *out += 7;
 }
 
 inline void VSEREST_UNPACK2_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -582,12 +588,12 @@ inline void VSEREST_UNPACK2_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 18) & 0x03;
 	(*out)[7] = (val >> 16) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 8;
 }
 
 inline void VSEREST_UNPACK2_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -599,12 +605,12 @@ inline void VSEREST_UNPACK2_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 16) & 0x03;
 	(*out)[8] = (val >> 14) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 1, *out += 9;
 }
 
 inline void VSEREST_UNPACK2_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -617,12 +623,12 @@ inline void VSEREST_UNPACK2_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 14) & 0x03;
 	(*out)[9] = (val >> 12) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 1, *out += 10;
 }
 
 inline void VSEREST_UNPACK2_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -636,12 +642,12 @@ inline void VSEREST_UNPACK2_11(uint32_t ** restrict out,
 	(*out)[9] = (val >> 12) & 0x03;
 	(*out)[10] = (val >> 10) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 10, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 10, st->fill, st->buf);
 	*in += 1, *out += 11;
 }
 
 inline void VSEREST_UNPACK2_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -656,12 +662,12 @@ inline void VSEREST_UNPACK2_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 10) & 0x03;
 	(*out)[11] = (val >> 8) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 12;
 }
 
 inline void VSEREST_UNPACK2_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -678,12 +684,12 @@ inline void VSEREST_UNPACK2_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 6) & 0x03;
 	(*out)[13] = (val >> 4) & 0x03;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 1, *out += 14;
 }
 
 inline void VSEREST_UNPACK2_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 30;
 	(*out)[1] = (val >> 28) & 0x03;
@@ -706,7 +712,7 @@ inline void VSEREST_UNPACK2_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK2_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 30;
@@ -729,7 +735,7 @@ inline void VSEREST_UNPACK2_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK2_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 30;
@@ -753,49 +759,49 @@ inline void VSEREST_UNPACK2_64(uint32_t ** restrict out,
 
 /* UNPACKER: 3 */
 inline void VSEREST_UNPACK3_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK3_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK3_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
 	(*out)[2] = (val >> 23) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 23, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 23, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK3_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
 	(*out)[2] = (val >> 23) & 0x07;
 	(*out)[3] = (val >> 20) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK3_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -803,12 +809,12 @@ inline void VSEREST_UNPACK3_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 20) & 0x07;
 	(*out)[4] = (val >> 17) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 17, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 17, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK3_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -817,12 +823,12 @@ inline void VSEREST_UNPACK3_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 17) & 0x07;
 	(*out)[5] = (val >> 14) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 1, *out += 6;
 }
 
 inline void VSEREST_UNPACK3_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -832,12 +838,12 @@ inline void VSEREST_UNPACK3_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 14) & 0x07;
 	(*out)[6] = (val >> 11) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 11, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 11, st->fill, st->buf);
 	*in += 1, *out += 7;
 }
 
 inline void VSEREST_UNPACK3_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -848,12 +854,12 @@ inline void VSEREST_UNPACK3_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 11) & 0x07;
 	(*out)[7] = (val >> 8) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 8;
 }
 
 inline void VSEREST_UNPACK3_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -865,12 +871,12 @@ inline void VSEREST_UNPACK3_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 8) & 0x07;
 	(*out)[8] = (val >> 5) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 5, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 5, st->fill, st->buf);
 	*in += 1, *out += 9;
 }
 
 inline void VSEREST_UNPACK3_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -883,12 +889,12 @@ inline void VSEREST_UNPACK3_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 5) & 0x07;
 	(*out)[9] = (val >> 2) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 2, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 2, st->fill, st->buf);
 	*in += 1, *out += 10;
 }
 
 inline void VSEREST_UNPACK3_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -905,12 +911,12 @@ inline void VSEREST_UNPACK3_11(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[10] |= val >> 31;
 
-	VSEREST_PUSH_BUF(val, 31, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 31, st->fill, st->buf);
 	*in += 2, *out += 11;
 }
 
 inline void VSEREST_UNPACK3_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -928,12 +934,12 @@ inline void VSEREST_UNPACK3_12(uint32_t ** restrict out,
 	(*out)[10] |= val >> 31;
 	(*out)[11] = (val >> 28) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 2, *out += 12;
 }
 
 inline void VSEREST_UNPACK3_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -953,12 +959,12 @@ inline void VSEREST_UNPACK3_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 25) & 0x07;
 	(*out)[13] = (val >> 22) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 2, *out += 14;
 }
 
 inline void VSEREST_UNPACK3_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -980,12 +986,12 @@ inline void VSEREST_UNPACK3_16(uint32_t ** restrict out,
 	(*out)[14] = (val >> 19) & 0x07;
 	(*out)[15] = (val >> 16) & 0x07;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 16;
 }
 
 inline void VSEREST_UNPACK3_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 29;
 	(*out)[1] = (val >> 26) & 0x07;
@@ -1030,7 +1036,7 @@ inline void VSEREST_UNPACK3_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK3_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 3, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 29;
@@ -1076,49 +1082,49 @@ inline void VSEREST_UNPACK3_64(uint32_t ** restrict out,
 
 /* UNPACKER: 4 */
 inline void VSEREST_UNPACK4_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK4_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK4_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
 	(*out)[2] = (val >> 20) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK4_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
 	(*out)[2] = (val >> 20) & 0x0f;
 	(*out)[3] = (val >> 16) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK4_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1126,12 +1132,12 @@ inline void VSEREST_UNPACK4_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 16) & 0x0f;
 	(*out)[4] = (val >> 12) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK4_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1140,12 +1146,12 @@ inline void VSEREST_UNPACK4_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 12) & 0x0f;
 	(*out)[5] = (val >> 8) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 6;
 }
 
 inline void VSEREST_UNPACK4_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1155,12 +1161,12 @@ inline void VSEREST_UNPACK4_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 8) & 0x0f;
 	(*out)[6] = (val >> 4) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 1, *out += 7;
 }
 
 inline void VSEREST_UNPACK4_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1175,7 +1181,7 @@ inline void VSEREST_UNPACK4_8(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK4_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1189,12 +1195,12 @@ inline void VSEREST_UNPACK4_9(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[8] = val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 2, *out += 9;
 }
 
 inline void VSEREST_UNPACK4_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1209,12 +1215,12 @@ inline void VSEREST_UNPACK4_10(uint32_t ** restrict out,
 	(*out)[8] = val >> 28;
 	(*out)[9] = (val >> 24) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 2, *out += 10;
 }
 
 inline void VSEREST_UNPACK4_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1230,12 +1236,12 @@ inline void VSEREST_UNPACK4_11(uint32_t ** restrict out,
 	(*out)[9] = (val >> 24) & 0x0f;
 	(*out)[10] = (val >> 20) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 2, *out += 11;
 }
 
 inline void VSEREST_UNPACK4_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1252,12 +1258,12 @@ inline void VSEREST_UNPACK4_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 20) & 0x0f;
 	(*out)[11] = (val >> 16) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 12;
 }
 
 inline void VSEREST_UNPACK4_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 28;
 	(*out)[1] = (val >> 24) & 0x0f;
@@ -1276,12 +1282,12 @@ inline void VSEREST_UNPACK4_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 12) & 0x0f;
 	(*out)[13] = (val >> 8) & 0x0f;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 2, *out += 14;
 }
 
 inline void VSEREST_UNPACK4_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 28;
@@ -1296,7 +1302,7 @@ inline void VSEREST_UNPACK4_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK4_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 28;
@@ -1311,7 +1317,7 @@ inline void VSEREST_UNPACK4_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK4_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 1, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 28;
@@ -1327,50 +1333,50 @@ inline void VSEREST_UNPACK4_64(uint32_t ** restrict out,
 
 /* UNPACKER: 5 */
 inline void VSEREST_UNPACK5_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 
-	VSEREST_PUSH_BUF(val, 27, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 27, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK5_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK5_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
 	(*out)[2] = (val >> 17) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 17, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 17, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK5_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
 	(*out)[2] = (val >> 17) & 0x1f;
 	(*out)[3] = (val >> 12) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK5_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
@@ -1379,12 +1385,12 @@ inline void VSEREST_UNPACK5_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 12) & 0x1f;
 	(*out)[4] = (val >> 7) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 7, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 7, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK5_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1393,12 +1399,12 @@ inline void VSEREST_UNPACK5_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 7) & 0x1f;
 	(*out)[5] = (val >> 2) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 2, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 2, st->fill, st->buf);
 	*in += 1, *out += 6;
 }
 
 inline void VSEREST_UNPACK5_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1411,12 +1417,12 @@ inline void VSEREST_UNPACK5_7(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[6] |= val >> 29;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 2, *out += 7;
 }
 
 inline void VSEREST_UNPACK5_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1430,12 +1436,12 @@ inline void VSEREST_UNPACK5_8(uint32_t ** restrict out,
 	(*out)[6] |= val >> 29;
 	(*out)[7] = (val >> 24) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 2, *out += 8;
 }
 
 inline void VSEREST_UNPACK5_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1450,12 +1456,12 @@ inline void VSEREST_UNPACK5_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 24) & 0x1f;
 	(*out)[8] = (val >> 19) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 19, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 19, st->fill, st->buf);
 	*in += 2, *out += 9;
 }
 
 inline void VSEREST_UNPACK5_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1471,12 +1477,12 @@ inline void VSEREST_UNPACK5_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 19) & 0x1f;
 	(*out)[9] = (val >> 14) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 2, *out += 10;
 }
 
 inline void VSEREST_UNPACK5_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1493,12 +1499,12 @@ inline void VSEREST_UNPACK5_11(uint32_t ** restrict out,
 	(*out)[9] = (val >> 14) & 0x1f;
 	(*out)[10] = (val >> 9) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 9, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 9, st->fill, st->buf);
 	*in += 2, *out += 11;
 }
 
 inline void VSEREST_UNPACK5_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1516,12 +1522,12 @@ inline void VSEREST_UNPACK5_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 9) & 0x1f;
 	(*out)[11] = (val >> 4) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 2, *out += 12;
 }
 
 inline void VSEREST_UNPACK5_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1544,12 +1550,12 @@ inline void VSEREST_UNPACK5_14(uint32_t ** restrict out,
 	(*out)[12] |= val >> 31;
 	(*out)[13] = (val >> 26) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 3, *out += 14;
 }
 
 inline void VSEREST_UNPACK5_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1574,12 +1580,12 @@ inline void VSEREST_UNPACK5_16(uint32_t ** restrict out,
 	(*out)[14] = (val >> 21) & 0x1f;
 	(*out)[15] = (val >> 16) & 0x1f;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 3, *out += 16;
 }
 
 inline void VSEREST_UNPACK5_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 27;
 	(*out)[1] = (val >> 22) & 0x1f;
@@ -1630,7 +1636,7 @@ inline void VSEREST_UNPACK5_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK5_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 5, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 27;
@@ -1682,49 +1688,49 @@ inline void VSEREST_UNPACK5_64(uint32_t ** restrict out,
 
 /* UNPACKER: 6 */
 inline void VSEREST_UNPACK6_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK6_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK6_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
 	(*out)[2] = (val >> 14) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK6_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
 	(*out)[2] = (val >> 14) & 0x3f;
 	(*out)[3] = (val >> 8) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK6_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1732,12 +1738,12 @@ inline void VSEREST_UNPACK6_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 8) & 0x3f;
 	(*out)[4] = (val >> 2) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 2, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 2, st->fill, st->buf);
 	*in += 1, *out += 5;
 }
 
 inline void VSEREST_UNPACK6_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1749,12 +1755,12 @@ inline void VSEREST_UNPACK6_6(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[5] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 2, *out += 6;
 }
 
 inline void VSEREST_UNPACK6_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1767,12 +1773,12 @@ inline void VSEREST_UNPACK6_7(uint32_t ** restrict out,
 	(*out)[5] |= val >> 28;
 	(*out)[6] = (val >> 22) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 2, *out += 7;
 }
 
 inline void VSEREST_UNPACK6_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1786,12 +1792,12 @@ inline void VSEREST_UNPACK6_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 22) & 0x3f;
 	(*out)[7] = (val >> 16) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 8;
 }
 
 inline void VSEREST_UNPACK6_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1806,12 +1812,12 @@ inline void VSEREST_UNPACK6_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 16) & 0x3f;
 	(*out)[8] = (val >> 10) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 10, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 10, st->fill, st->buf);
 	*in += 2, *out += 9;
 }
 
 inline void VSEREST_UNPACK6_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1827,12 +1833,12 @@ inline void VSEREST_UNPACK6_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 10) & 0x3f;
 	(*out)[9] = (val >> 4) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 2, *out += 10;
 }
 
 inline void VSEREST_UNPACK6_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1852,12 +1858,12 @@ inline void VSEREST_UNPACK6_11(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[10] |= val >> 30;
 
-	VSEREST_PUSH_BUF(val, 30, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 30, st->fill, st->buf);
 	*in += 3, *out += 11;
 }
 
 inline void VSEREST_UNPACK6_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1878,12 +1884,12 @@ inline void VSEREST_UNPACK6_12(uint32_t ** restrict out,
 	(*out)[10] |= val >> 30;
 	(*out)[11] = (val >> 24) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 3, *out += 12;
 }
 
 inline void VSEREST_UNPACK6_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1906,12 +1912,12 @@ inline void VSEREST_UNPACK6_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 18) & 0x3f;
 	(*out)[13] = (val >> 12) & 0x3f;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 3, *out += 14;
 }
 
 inline void VSEREST_UNPACK6_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 26;
 	(*out)[1] = (val >> 20) & 0x3f;
@@ -1940,7 +1946,7 @@ inline void VSEREST_UNPACK6_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK6_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 3, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 26;
@@ -1969,7 +1975,7 @@ inline void VSEREST_UNPACK6_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK6_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 3, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 26;
@@ -1999,49 +2005,49 @@ inline void VSEREST_UNPACK6_64(uint32_t ** restrict out,
 
 /* UNPACKER: 7 */
 inline void VSEREST_UNPACK7_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 
-	VSEREST_PUSH_BUF(val, 25, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 25, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK7_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 18, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 18, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK7_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
 	(*out)[2] = (val >> 11) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 11, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 11, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK7_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
 	(*out)[2] = (val >> 11) & 0x7f;
 	(*out)[3] = (val >> 4) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 1, *out += 4;
 }
 
 inline void VSEREST_UNPACK7_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2052,12 +2058,12 @@ inline void VSEREST_UNPACK7_5(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[4] |= val >> 29;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK7_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2069,12 +2075,12 @@ inline void VSEREST_UNPACK7_6(uint32_t ** restrict out,
 	(*out)[4] |= val >> 29;
 	(*out)[5] = (val >> 22) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 2, *out += 6;
 }
 
 inline void VSEREST_UNPACK7_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2087,12 +2093,12 @@ inline void VSEREST_UNPACK7_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 22) & 0x7f;
 	(*out)[6] = (val >> 15) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 15, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 15, st->fill, st->buf);
 	*in += 2, *out += 7;
 }
 
 inline void VSEREST_UNPACK7_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2106,12 +2112,12 @@ inline void VSEREST_UNPACK7_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 15) & 0x7f;
 	(*out)[7] = (val >> 8) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 2, *out += 8;
 }
 
 inline void VSEREST_UNPACK7_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2126,12 +2132,12 @@ inline void VSEREST_UNPACK7_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 8) & 0x7f;
 	(*out)[8] = (val >> 1) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 1, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 1, st->fill, st->buf);
 	*in += 2, *out += 9;
 }
 
 inline void VSEREST_UNPACK7_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2150,12 +2156,12 @@ inline void VSEREST_UNPACK7_10(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[9] |= val >> 26;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 3, *out += 10;
 }
 
 inline void VSEREST_UNPACK7_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2175,12 +2181,12 @@ inline void VSEREST_UNPACK7_11(uint32_t ** restrict out,
 	(*out)[9] |= val >> 26;
 	(*out)[10] = (val >> 19) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 19, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 19, st->fill, st->buf);
 	*in += 3, *out += 11;
 }
 
 inline void VSEREST_UNPACK7_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2201,12 +2207,12 @@ inline void VSEREST_UNPACK7_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 19) & 0x7f;
 	(*out)[11] = (val >> 12) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 3, *out += 12;
 }
 
 inline void VSEREST_UNPACK7_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2232,12 +2238,12 @@ inline void VSEREST_UNPACK7_14(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[13] |= val >> 30;
 
-	VSEREST_PUSH_BUF(val, 30, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 30, st->fill, st->buf);
 	*in += 4, *out += 14;
 }
 
 inline void VSEREST_UNPACK7_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2265,12 +2271,12 @@ inline void VSEREST_UNPACK7_16(uint32_t ** restrict out,
 	(*out)[14] = (val >> 23) & 0x7f;
 	(*out)[15] = (val >> 16) & 0x7f;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 4, *out += 16;
 }
 
 inline void VSEREST_UNPACK7_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 25;
 	(*out)[1] = (val >> 18) & 0x7f;
@@ -2327,7 +2333,7 @@ inline void VSEREST_UNPACK7_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK7_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 7, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 25;
@@ -2385,37 +2391,37 @@ inline void VSEREST_UNPACK7_64(uint32_t ** restrict out,
 
 /* UNPACKER: 8 */
 inline void VSEREST_UNPACK8_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK8_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK8_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
 	(*out)[2] = (val >> 8) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK8_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
@@ -2426,7 +2432,7 @@ inline void VSEREST_UNPACK8_4(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK8_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
@@ -2436,12 +2442,12 @@ inline void VSEREST_UNPACK8_5(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[4] = val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK8_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
@@ -2453,12 +2459,12 @@ inline void VSEREST_UNPACK8_6(uint32_t ** restrict out,
 	(*out)[4] = val >> 24;
 	(*out)[5] = (val >> 16) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 6;
 }
 
 inline void VSEREST_UNPACK8_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
@@ -2471,12 +2477,12 @@ inline void VSEREST_UNPACK8_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 16) & 0xff;
 	(*out)[6] = (val >> 8) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 2, *out += 7;
 }
 
 inline void VSEREST_UNPACK8_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2487,7 +2493,7 @@ inline void VSEREST_UNPACK8_8(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK8_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2499,12 +2505,12 @@ inline void VSEREST_UNPACK8_9(uint32_t ** restrict out,
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK8_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2517,12 +2523,12 @@ inline void VSEREST_UNPACK8_10(uint32_t ** restrict out,
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK8_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2536,12 +2542,12 @@ inline void VSEREST_UNPACK8_11(uint32_t ** restrict out,
 	(*out)[1] = (val >> 16) & 0xff;
 	(*out)[2] = (val >> 8) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK8_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 3; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2552,7 +2558,7 @@ inline void VSEREST_UNPACK8_12(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK8_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 3; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2565,12 +2571,12 @@ inline void VSEREST_UNPACK8_14(uint32_t ** restrict out,
 	(*out)[0] = val >> 24;
 	(*out)[1] = (val >> 16) & 0xff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK8_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2581,7 +2587,7 @@ inline void VSEREST_UNPACK8_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK8_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2592,7 +2598,7 @@ inline void VSEREST_UNPACK8_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK8_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 16; i++, *in += 1, *out += 4) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 24;
@@ -2604,37 +2610,37 @@ inline void VSEREST_UNPACK8_64(uint32_t ** restrict out,
 
 /* UNPACKER: 9 */
 inline void VSEREST_UNPACK9_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 
-	VSEREST_PUSH_BUF(val, 23, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 23, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK9_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK9_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
 	(*out)[2] = (val >> 5) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 5, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 5, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK9_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2644,12 +2650,12 @@ inline void VSEREST_UNPACK9_4(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[3] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 2, *out += 4;
 }
 
 inline void VSEREST_UNPACK9_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2660,12 +2666,12 @@ inline void VSEREST_UNPACK9_5(uint32_t ** restrict out,
 	(*out)[3] |= val >> 28;
 	(*out)[4] = (val >> 19) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 19, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 19, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK9_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2677,12 +2683,12 @@ inline void VSEREST_UNPACK9_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 19) & 0x01ff;
 	(*out)[5] = (val >> 10) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 10, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 10, st->fill, st->buf);
 	*in += 2, *out += 6;
 }
 
 inline void VSEREST_UNPACK9_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2695,12 +2701,12 @@ inline void VSEREST_UNPACK9_7(uint32_t ** restrict out,
 	(*out)[5] = (val >> 10) & 0x01ff;
 	(*out)[6] = (val >> 1) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 1, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 1, st->fill, st->buf);
 	*in += 2, *out += 7;
 }
 
 inline void VSEREST_UNPACK9_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2717,12 +2723,12 @@ inline void VSEREST_UNPACK9_8(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[7] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 3, *out += 8;
 }
 
 inline void VSEREST_UNPACK9_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2740,12 +2746,12 @@ inline void VSEREST_UNPACK9_9(uint32_t ** restrict out,
 	(*out)[7] |= val >> 24;
 	(*out)[8] = (val >> 15) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 15, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 15, st->fill, st->buf);
 	*in += 3, *out += 9;
 }
 
 inline void VSEREST_UNPACK9_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2764,12 +2770,12 @@ inline void VSEREST_UNPACK9_10(uint32_t ** restrict out,
 	(*out)[8] = (val >> 15) & 0x01ff;
 	(*out)[9] = (val >> 6) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 6, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 6, st->fill, st->buf);
 	*in += 3, *out += 10;
 }
 
 inline void VSEREST_UNPACK9_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2792,12 +2798,12 @@ inline void VSEREST_UNPACK9_11(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[10] |= val >> 29;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 4, *out += 11;
 }
 
 inline void VSEREST_UNPACK9_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2821,12 +2827,12 @@ inline void VSEREST_UNPACK9_12(uint32_t ** restrict out,
 	(*out)[10] |= val >> 29;
 	(*out)[11] = (val >> 20) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 4, *out += 12;
 }
 
 inline void VSEREST_UNPACK9_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2852,12 +2858,12 @@ inline void VSEREST_UNPACK9_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 11) & 0x01ff;
 	(*out)[13] = (val >> 2) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 2, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 2, st->fill, st->buf);
 	*in += 4, *out += 14;
 }
 
 inline void VSEREST_UNPACK9_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2888,12 +2894,12 @@ inline void VSEREST_UNPACK9_16(uint32_t ** restrict out,
 	(*out)[14] |= val >> 25;
 	(*out)[15] = (val >> 16) & 0x01ff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 5, *out += 16;
 }
 
 inline void VSEREST_UNPACK9_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 23;
 	(*out)[1] = (val >> 14) & 0x01ff;
@@ -2956,7 +2962,7 @@ inline void VSEREST_UNPACK9_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK9_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 9, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 23;
@@ -3020,37 +3026,37 @@ inline void VSEREST_UNPACK9_64(uint32_t ** restrict out,
 
 /* UNPACKER: 10 */
 inline void VSEREST_UNPACK10_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 
-	VSEREST_PUSH_BUF(val, 22, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 22, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK10_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK10_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
 	(*out)[2] = (val >> 2) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 2, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 2, st->fill, st->buf);
 	*in += 1, *out += 3;
 }
 
 inline void VSEREST_UNPACK10_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3060,12 +3066,12 @@ inline void VSEREST_UNPACK10_4(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[3] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 2, *out += 4;
 }
 
 inline void VSEREST_UNPACK10_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3076,12 +3082,12 @@ inline void VSEREST_UNPACK10_5(uint32_t ** restrict out,
 	(*out)[3] |= val >> 24;
 	(*out)[4] = (val >> 14) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 14, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 14, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK10_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3093,12 +3099,12 @@ inline void VSEREST_UNPACK10_6(uint32_t ** restrict out,
 	(*out)[4] = (val >> 14) & 0x03ff;
 	(*out)[5] = (val >> 4) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 2, *out += 6;
 }
 
 inline void VSEREST_UNPACK10_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3114,12 +3120,12 @@ inline void VSEREST_UNPACK10_7(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[6] |= val >> 26;
 
-	VSEREST_PUSH_BUF(val, 26, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 26, st->fill, st->buf);
 	*in += 3, *out += 7;
 }
 
 inline void VSEREST_UNPACK10_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3136,12 +3142,12 @@ inline void VSEREST_UNPACK10_8(uint32_t ** restrict out,
 	(*out)[6] |= val >> 26;
 	(*out)[7] = (val >> 16) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 3, *out += 8;
 }
 
 inline void VSEREST_UNPACK10_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3159,12 +3165,12 @@ inline void VSEREST_UNPACK10_9(uint32_t ** restrict out,
 	(*out)[7] = (val >> 16) & 0x03ff;
 	(*out)[8] = (val >> 6) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 6, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 6, st->fill, st->buf);
 	*in += 3, *out += 9;
 }
 
 inline void VSEREST_UNPACK10_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3186,12 +3192,12 @@ inline void VSEREST_UNPACK10_10(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[9] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 4, *out += 10;
 }
 
 inline void VSEREST_UNPACK10_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3214,12 +3220,12 @@ inline void VSEREST_UNPACK10_11(uint32_t ** restrict out,
 	(*out)[9] |= val >> 28;
 	(*out)[10] = (val >> 18) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 18, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 18, st->fill, st->buf);
 	*in += 4, *out += 11;
 }
 
 inline void VSEREST_UNPACK10_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3243,12 +3249,12 @@ inline void VSEREST_UNPACK10_12(uint32_t ** restrict out,
 	(*out)[10] = (val >> 18) & 0x03ff;
 	(*out)[11] = (val >> 8) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 4, *out += 12;
 }
 
 inline void VSEREST_UNPACK10_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3277,12 +3283,12 @@ inline void VSEREST_UNPACK10_14(uint32_t ** restrict out,
 	(*out)[12] |= val >> 30;
 	(*out)[13] = (val >> 20) & 0x03ff;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 5, *out += 14;
 }
 
 inline void VSEREST_UNPACK10_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 22;
 	(*out)[1] = (val >> 12) & 0x03ff;
@@ -3317,7 +3323,7 @@ inline void VSEREST_UNPACK10_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK10_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 5, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 22;
@@ -3352,7 +3358,7 @@ inline void VSEREST_UNPACK10_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK10_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 5, *out += 16) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 22;
@@ -3388,26 +3394,26 @@ inline void VSEREST_UNPACK10_64(uint32_t ** restrict out,
 
 /* UNPACKER: 11 */
 inline void VSEREST_UNPACK11_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 
-	VSEREST_PUSH_BUF(val, 21, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 21, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK11_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 10, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 10, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK11_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3416,12 +3422,12 @@ inline void VSEREST_UNPACK11_3(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[2] |= val >> 31;
 
-	VSEREST_PUSH_BUF(val, 31, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 31, st->fill, st->buf);
 	*in += 2, *out += 3;
 }
 
 inline void VSEREST_UNPACK11_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3431,12 +3437,12 @@ inline void VSEREST_UNPACK11_4(uint32_t ** restrict out,
 	(*out)[2] |= val >> 31;
 	(*out)[3] = (val >> 20) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 2, *out += 4;
 }
 
 inline void VSEREST_UNPACK11_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3447,12 +3453,12 @@ inline void VSEREST_UNPACK11_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 20) & 0x07ff;
 	(*out)[4] = (val >> 9) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 9, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 9, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK11_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3467,12 +3473,12 @@ inline void VSEREST_UNPACK11_6(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[5] |= val >> 30;
 
-	VSEREST_PUSH_BUF(val, 30, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 30, st->fill, st->buf);
 	*in += 3, *out += 6;
 }
 
 inline void VSEREST_UNPACK11_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3488,12 +3494,12 @@ inline void VSEREST_UNPACK11_7(uint32_t ** restrict out,
 	(*out)[5] |= val >> 30;
 	(*out)[6] = (val >> 19) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 19, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 19, st->fill, st->buf);
 	*in += 3, *out += 7;
 }
 
 inline void VSEREST_UNPACK11_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3510,12 +3516,12 @@ inline void VSEREST_UNPACK11_8(uint32_t ** restrict out,
 	(*out)[6] = (val >> 19) & 0x07ff;
 	(*out)[7] = (val >> 8) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 3, *out += 8;
 }
 
 inline void VSEREST_UNPACK11_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3536,12 +3542,12 @@ inline void VSEREST_UNPACK11_9(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[8] |= val >> 29;
 
-	VSEREST_PUSH_BUF(val, 29, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 29, st->fill, st->buf);
 	*in += 4, *out += 9;
 }
 
 inline void VSEREST_UNPACK11_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3563,12 +3569,12 @@ inline void VSEREST_UNPACK11_10(uint32_t ** restrict out,
 	(*out)[8] |= val >> 29;
 	(*out)[9] = (val >> 18) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 18, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 18, st->fill, st->buf);
 	*in += 4, *out += 10;
 }
 
 inline void VSEREST_UNPACK11_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3591,12 +3597,12 @@ inline void VSEREST_UNPACK11_11(uint32_t ** restrict out,
 	(*out)[9] = (val >> 18) & 0x07ff;
 	(*out)[10] = (val >> 7) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 7, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 7, st->fill, st->buf);
 	*in += 4, *out += 11;
 }
 
 inline void VSEREST_UNPACK11_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3623,12 +3629,12 @@ inline void VSEREST_UNPACK11_12(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 4);
 	(*out)[11] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 5, *out += 12;
 }
 
 inline void VSEREST_UNPACK11_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3657,12 +3663,12 @@ inline void VSEREST_UNPACK11_14(uint32_t ** restrict out,
 	(*out)[12] = (val >> 17) & 0x07ff;
 	(*out)[13] = (val >> 6) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 6, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 6, st->fill, st->buf);
 	*in += 5, *out += 14;
 }
 
 inline void VSEREST_UNPACK11_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3696,12 +3702,12 @@ inline void VSEREST_UNPACK11_16(uint32_t ** restrict out,
 	(*out)[14] |= val >> 27;
 	(*out)[15] = (val >> 16) & 0x07ff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 6, *out += 16;
 }
 
 inline void VSEREST_UNPACK11_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 21;
 	(*out)[1] = (val >> 10) & 0x07ff;
@@ -3770,7 +3776,7 @@ inline void VSEREST_UNPACK11_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK11_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 11, *out += 32) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 21;
@@ -3840,26 +3846,26 @@ inline void VSEREST_UNPACK11_64(uint32_t ** restrict out,
 
 /* UNPACKER: 12 */
 inline void VSEREST_UNPACK12_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK12_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 1, *out += 2;
 }
 
 inline void VSEREST_UNPACK12_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3868,12 +3874,12 @@ inline void VSEREST_UNPACK12_3(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[2] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 2, *out += 3;
 }
 
 inline void VSEREST_UNPACK12_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3883,12 +3889,12 @@ inline void VSEREST_UNPACK12_4(uint32_t ** restrict out,
 	(*out)[2] |= val >> 28;
 	(*out)[3] = (val >> 16) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 4;
 }
 
 inline void VSEREST_UNPACK12_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3899,12 +3905,12 @@ inline void VSEREST_UNPACK12_5(uint32_t ** restrict out,
 	(*out)[3] = (val >> 16) & 0x0fff;
 	(*out)[4] = (val >> 4) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 2, *out += 5;
 }
 
 inline void VSEREST_UNPACK12_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3919,12 +3925,12 @@ inline void VSEREST_UNPACK12_6(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[5] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 3, *out += 6;
 }
 
 inline void VSEREST_UNPACK12_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3940,12 +3946,12 @@ inline void VSEREST_UNPACK12_7(uint32_t ** restrict out,
 	(*out)[5] |= val >> 24;
 	(*out)[6] = (val >> 12) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 3, *out += 7;
 }
 
 inline void VSEREST_UNPACK12_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3966,7 +3972,7 @@ inline void VSEREST_UNPACK12_8(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK12_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -3986,12 +3992,12 @@ inline void VSEREST_UNPACK12_9(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[8] = val >> 20;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 4, *out += 9;
 }
 
 inline void VSEREST_UNPACK12_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -4012,12 +4018,12 @@ inline void VSEREST_UNPACK12_10(uint32_t ** restrict out,
 	(*out)[8] = val >> 20;
 	(*out)[9] = (val >> 8) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 4, *out += 10;
 }
 
 inline void VSEREST_UNPACK12_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -4042,12 +4048,12 @@ inline void VSEREST_UNPACK12_11(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 4);
 	(*out)[10] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 5, *out += 11;
 }
 
 inline void VSEREST_UNPACK12_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -4073,12 +4079,12 @@ inline void VSEREST_UNPACK12_12(uint32_t ** restrict out,
 	(*out)[10] |= val >> 28;
 	(*out)[11] = (val >> 16) & 0x0fff;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 5, *out += 12;
 }
 
 inline void VSEREST_UNPACK12_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 20;
 	(*out)[1] = (val >> 8) & 0x0fff;
@@ -4109,12 +4115,12 @@ inline void VSEREST_UNPACK12_14(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 5);
 	(*out)[13] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 6, *out += 14;
 }
 
 inline void VSEREST_UNPACK12_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 3, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 20;
@@ -4135,7 +4141,7 @@ inline void VSEREST_UNPACK12_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK12_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 3, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 20;
@@ -4156,7 +4162,7 @@ inline void VSEREST_UNPACK12_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK12_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 3, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 20;
@@ -4178,16 +4184,16 @@ inline void VSEREST_UNPACK12_64(uint32_t ** restrict out,
 
 /* UNPACKER: 16 */
 inline void VSEREST_UNPACK16_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK16_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 	(*out)[1] = val & 0xffff;
@@ -4196,7 +4202,7 @@ inline void VSEREST_UNPACK16_2(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 	(*out)[1] = val & 0xffff;
@@ -4204,12 +4210,12 @@ inline void VSEREST_UNPACK16_3(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[2] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 2, *out += 3;
 }
 
 inline void VSEREST_UNPACK16_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4218,7 +4224,7 @@ inline void VSEREST_UNPACK16_4(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4228,12 +4234,12 @@ inline void VSEREST_UNPACK16_5(uint32_t ** restrict out,
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK16_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 3; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4242,7 +4248,7 @@ inline void VSEREST_UNPACK16_6(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 3; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4252,12 +4258,12 @@ inline void VSEREST_UNPACK16_7(uint32_t ** restrict out,
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK16_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4266,7 +4272,7 @@ inline void VSEREST_UNPACK16_8(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4276,12 +4282,12 @@ inline void VSEREST_UNPACK16_9(uint32_t ** restrict out,
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK16_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 5; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4290,7 +4296,7 @@ inline void VSEREST_UNPACK16_10(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 5; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4300,12 +4306,12 @@ inline void VSEREST_UNPACK16_11(uint32_t ** restrict out,
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK16_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 6; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4314,7 +4320,7 @@ inline void VSEREST_UNPACK16_12(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 7; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4323,7 +4329,7 @@ inline void VSEREST_UNPACK16_14(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4332,7 +4338,7 @@ inline void VSEREST_UNPACK16_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 16; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4341,7 +4347,7 @@ inline void VSEREST_UNPACK16_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK16_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 32; i++, *in += 1, *out += 2) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 16;
@@ -4351,16 +4357,16 @@ inline void VSEREST_UNPACK16_64(uint32_t ** restrict out,
 
 /* UNPACKER: 20 */
 inline void VSEREST_UNPACK20_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK20_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4368,12 +4374,12 @@ inline void VSEREST_UNPACK20_2(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 1);
 	(*out)[1] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 2, *out += 2;
 }
 
 inline void VSEREST_UNPACK20_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4382,12 +4388,12 @@ inline void VSEREST_UNPACK20_3(uint32_t ** restrict out,
 	(*out)[1] |= val >> 24;
 	(*out)[2] = (val >> 4) & 0xfffff;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 2, *out += 3;
 }
 
 inline void VSEREST_UNPACK20_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4400,12 +4406,12 @@ inline void VSEREST_UNPACK20_4(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 2);
 	(*out)[3] |= val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 3, *out += 4;
 }
 
 inline void VSEREST_UNPACK20_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4422,12 +4428,12 @@ inline void VSEREST_UNPACK20_5(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 3);
 	(*out)[4] |= val >> 28;
 
-	VSEREST_PUSH_BUF(val, 28, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 28, st->fill, st->buf);
 	*in += 4, *out += 5;
 }
 
 inline void VSEREST_UNPACK20_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4445,12 +4451,12 @@ inline void VSEREST_UNPACK20_6(uint32_t ** restrict out,
 	(*out)[4] |= val >> 28;
 	(*out)[5] = (val >> 8) & 0xfffff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 4, *out += 6;
 }
 
 inline void VSEREST_UNPACK20_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4472,12 +4478,12 @@ inline void VSEREST_UNPACK20_7(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 4);
 	(*out)[6] |= val >> 20;
 
-	VSEREST_PUSH_BUF(val, 20, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 20, st->fill, st->buf);
 	*in += 5, *out += 7;
 }
 
 inline void VSEREST_UNPACK20_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4504,7 +4510,7 @@ inline void VSEREST_UNPACK20_8(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK20_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4530,12 +4536,12 @@ inline void VSEREST_UNPACK20_9(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 5);
 	(*out)[8] = val >> 12;
 
-	VSEREST_PUSH_BUF(val, 12, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 12, st->fill, st->buf);
 	*in += 6, *out += 9;
 }
 
 inline void VSEREST_UNPACK20_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4565,12 +4571,12 @@ inline void VSEREST_UNPACK20_10(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 6);
 	(*out)[9] |= val >> 24;
 
-	VSEREST_PUSH_BUF(val, 24, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 24, st->fill, st->buf);
 	*in += 7, *out += 10;
 }
 
 inline void VSEREST_UNPACK20_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4601,12 +4607,12 @@ inline void VSEREST_UNPACK20_11(uint32_t ** restrict out,
 	(*out)[9] |= val >> 24;
 	(*out)[10] = (val >> 4) & 0xfffff;
 
-	VSEREST_PUSH_BUF(val, 4, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 4, st->fill, st->buf);
 	*in += 7, *out += 11;
 }
 
 inline void VSEREST_UNPACK20_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
 	(*out)[1] = (val << 8) & 0x0fffff;
@@ -4641,12 +4647,12 @@ inline void VSEREST_UNPACK20_12(uint32_t ** restrict out,
 	val = BYTEORDER_FREE_LOAD32(*in + 7);
 	(*out)[11] |= val >> 16;
 
-	VSEREST_PUSH_BUF(val, 16, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 16, st->fill, st->buf);
 	*in += 8, *out += 12;
 }
 
 inline void VSEREST_UNPACK20_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 
 	uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 	(*out)[0] = val >> 12;
@@ -4687,12 +4693,12 @@ inline void VSEREST_UNPACK20_14(uint32_t ** restrict out,
 	(*out)[12] |= val >> 28;
 	(*out)[13] = (val >> 8) & 0xfffff;
 
-	VSEREST_PUSH_BUF(val, 8, number_of_filled_bits, buffer_data);
+	VSEREST_PUSH_BUF(val, 8, st->fill, st->buf);
 	*in += 9, *out += 14;
 }
 
 inline void VSEREST_UNPACK20_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 5, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 12;
@@ -4719,7 +4725,7 @@ inline void VSEREST_UNPACK20_16(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK20_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 5, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 12;
@@ -4746,7 +4752,7 @@ inline void VSEREST_UNPACK20_32(uint32_t ** restrict out,
 }
 
 inline void VSEREST_UNPACK20_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 5, *out += 8) {
 		uint32_t val = BYTEORDER_FREE_LOAD32(*in);
 		(*out)[0] = val >> 12;
@@ -4774,98 +4780,98 @@ inline void VSEREST_UNPACK20_64(uint32_t ** restrict out,
 
 /* UNPACKER: 32 */
 inline void VSEREST_UNPACK32_1(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 	*in += 1, *out += 1;
 }
 
 inline void VSEREST_UNPACK32_2(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 2; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_3(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 3; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_4(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 4; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_5(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 5; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_6(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 6; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_7(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 7; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_8(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 8; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_9(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 9; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 
 }
 
 inline void VSEREST_UNPACK32_10(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 10; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_11(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 11; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_12(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 12; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_14(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 14; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_16(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 16; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_32(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 32; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
 
 inline void VSEREST_UNPACK32_64(uint32_t ** restrict out,
-		uint32_t ** restrict in) {
+		const uint32_t ** restrict in, vserest_state_t * restrict st) {
 	for (uint32_t i = 0; i < 64; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
@@ -4881,11 +4887,36 @@ const uint32_t VSEREST_CODELOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
 		13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
 		15, 15 };
 
+/* Bit widths that each of codelogs above stands for */
+const uint32_t VSEREST_LOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+		16, 20, 32 };
+
+/* Add decode costs calibrated at the first use if necessary */
+VSEPartitionConfig ResolveConfig(const VSEPartitionConfig& conf) {
+	return ResolveVSEPartitionConfig(conf, VSEREST_LENS, NULL,
+			ARRAYSIZE(VSEREST_LENS), false, VSEREST_REMAPLOGS,
+			[](std::shared_ptr<VSEncodingPartitioner> p) {
+				return EncodingPtr(new VSEncodingRest(p));
+			});
+}
+
 } /* namespace: */
 
 VSEncodingRest::VSEncodingRest() :
-		EncodingBase(E_VSEREST), vdp_(new VSEncodingDP(VSEREST_LENS,
-		NULL, ARRAYSIZE(VSEREST_LENS), false)) {
+		EncodingBase(E_VSEREST), vdp_(CreateVSEPartitioner(VSEREST_LENS,
+		NULL, ARRAYSIZE(VSEREST_LENS), false,
+		ResolveConfig(GetVSEPartitionConfig()))) {
+}
+
+VSEncodingRest::VSEncodingRest(const VSEPartitionConfig& conf) :
+		EncodingBase(E_VSEREST), vdp_(CreateVSEPartitioner(VSEREST_LENS,
+		NULL, ARRAYSIZE(VSEREST_LENS), false, ResolveConfig(conf))) {
+}
+
+VSEncodingRest::VSEncodingRest(std::shared_ptr<VSEncodingPartitioner> vdp) :
+		EncodingBase(E_VSEREST), vdp_(vdp) {
+	if (vdp == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid value: vdp");
 }
 
 VSEncodingRest::~VSEncodingRest() throw () {
@@ -5091,8 +5122,8 @@ void VSEncodingRest::encodeArray(const uint32_t *in, uint64_t len,
 
 		if (parts[i] + offset < parts[i + 1]) {
 			/* Write left integers */
-			for (uint64_t j = parts[i] + offset; j < parts[i + 1]; j++)
-				wt2.write_bits(in[j], maxB);
+			wt2.write_fixed_array(&in[parts[i] + offset],
+					parts[i + 1] - parts[i] - offset, maxB);
 
 			/* Remember the position of padding areas */
 			VSEREST_PUSH_RBUF(32 - ((parts[i + 1] - parts[i]) * maxB) % 32,
@@ -5113,7 +5144,8 @@ void VSEncodingRest::encodeArray(const uint32_t *in, uint64_t len,
 
 namespace {
 
-typedef void (*vserest_unpack_t)(uint32_t **out, uint32_t **in);
+typedef void (*vserest_unpack_t)(uint32_t **out, const uint32_t **in,
+		vserest_state_t *st);
 
 vserest_unpack_t VSEREST_UNPACK[VSEREST_LEN] {
 /* UNPACKER: 0 */
@@ -5243,15 +5275,38 @@ VSEREST_UNPACK0_1, VSEREST_UNPACK0_2, VSEREST_UNPACK0_3, VSEREST_UNPACK0_4,
 		VSEREST_UNPACK32_14, VSEREST_UNPACK32_16, VSEREST_UNPACK32_32,
 		VSEREST_UNPACK32_64 };
 
+/* The max # of words that a block occupies */
+const uint32_t VSEREST_STAGE_LEN = 64;
+
+/*
+ * Unpack a block with a descriptor. If paddings have a word, the
+ * block starts with it, so the word and the rest of the block are
+ * staged in a local buffer instead of being written back to input.
+ */
+inline void VSEREST_DECODE(uint32_t desc, uint32_t ** restrict out,
+		const uint32_t ** restrict in, const uint32_t *iterm,
+		vserest_state_t * restrict st) {
+	if (UNLIKELY(st->fill >= 32) && (desc >> VSEREST_LOGLEN) != 0) {
+		uint32_t stage[VSEREST_STAGE_LEN];
+		uint64_t nw = DIV_ROUNDUP(VSEREST_LENS[desc & (VSEREST_LENS_LEN - 1)] *
+				VSEREST_LOGS[desc >> VSEREST_LOGLEN], 32);
+		uint64_t rest = std::min(nw - 1, static_cast<uint64_t>(iterm - *in));
+
+		stage[0] = st->buf >> (st->fill -= 32);
+		memcpy(stage + 1, *in, rest * sizeof(uint32_t));
+
+		const uint32_t *p = stage;
+		(VSEREST_UNPACK[desc])(out, &p, st);
+		*in += (p - stage) - 1;
+	} else {
+		(VSEREST_UNPACK[desc])(out, in, st);
+	}
+}
+
 } /* namespace: */
 
 void VSEncodingRest::decodeArray(const uint32_t *in, uint64_t len,
 		uint32_t *out, uint64_t nvalue) const {
-	VSEncodingRest::decodeArray(const_cast<uint32_t *>(in), len, out, nvalue);
-}
-
-void VSEncodingRest::decodeArray(uint32_t *in, uint64_t len, uint32_t *out,
-		uint64_t nvalue) const {
 	if (in == NULL)
 		THROW_ENCODING_EXCEPTION("Invalid input: in");
 	if (len == 0)
@@ -5263,43 +5318,37 @@ void VSEncodingRest::decodeArray(uint32_t *in, uint64_t len, uint32_t *out,
 
 	ASSERT_ADDR(in, len); ASSERT_ADDR(out, nvalue);
 
-	uint32_t *iterm = in + len;
+	const uint32_t *iterm = in + len;
 	uint32_t *oterm = out + nvalue;
 
 	uint64_t num = BYTEORDER_FREE_LOAD64(in);
 	in += 2;
 
 	uint64_t offset = DIV_ROUNDUP(num, 4);
-	uint32_t *data = in + offset;
+	const uint32_t *data = in + offset;
 
 #define VSEREST_DESC(__val__, __offset__) \
     (((__val__) >> VSEREST_LOGDESC * __offset__) & (VSEREST_LEN - 1))
 
-#define VSEREST_RESTORE_BUF(__in__, __fill__, __buf__)  \
-    UNLIKELY(__fill__ >= 32)? *(--__in__) = __buf__ >> (__fill__ -= 32) : 0
-
 	/* Initialize a buffer for paddings */
-	number_of_filled_bits = 0;
-	buffer_data = 0;
+	vserest_state_t st;
+	st.fill = 0;
+	st.buf = 0;
 
-	while (LIKELY(out < oterm && data < iterm)) {
+	while (LIKELY(out < oterm && (data < iterm || st.fill >= 32))) {
 		uint32_t d = *in++;
 
 		/* Unpacking integers with a first 8-bit */
-		(VSEREST_UNPACK[VSEREST_DESC(d, 3)])(&out, &data);
-		VSEREST_RESTORE_BUF(data, number_of_filled_bits, buffer_data);
+		VSEREST_DECODE(VSEREST_DESC(d, 3), &out, &data, iterm, &st);
 
 		/* Unpacking integers with a second 8-bit */
-		(VSEREST_UNPACK[VSEREST_DESC(d, 2)])(&out, &data);
-		VSEREST_RESTORE_BUF(data, number_of_filled_bits, buffer_data);
+		VSEREST_DECODE(VSEREST_DESC(d, 2), &out, &data, iterm, &st);
 
 		/* Unpacking integers with a third 8-bit */
-		(VSEREST_UNPACK[VSEREST_DESC(d, 1)])(&out, &data);
-		VSEREST_RESTORE_BUF(data, number_of_filled_bits, buffer_data);
+		VSEREST_DECODE(VSEREST_DESC(d, 1), &out, &data, iterm, &st);
 
 		/* Unpacking integers with a last 8-bit */
-		(VSEREST_UNPACK[VSEREST_DESC(d, 0)])(&out, &data);
-		VSEREST_RESTORE_BUF(data, number_of_filled_bits, buffer_data);
+		VSEREST_DECODE(VSEREST_DESC(d, 0), &out, &data, iterm, &st);
 	}
 }
 
@@ -41,8 +41,8 @@ const uint32_t VSESIMPLE_CODELOGS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
 		12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15,
 		15, 15, 15 };
 
-/* FIXME: It complies with MAXLEN in vcompress.hpp */
-const uint64_t MAXLEN = 100000000;
+/* # of descriptors that a jump table is filled with at once */
+const uint64_t VSESIMPLE_JTABLE_LEN = 256;
 
 //unpackI_J表示解压缩J个位宽为I的数字
 /* Unpacker: 0 */
@@ -4693,27 +4693,50 @@ inline void VSESIMPLE_UNPACK32_64(uint32_t ** restrict out,
 	for (uint32_t i = 0; i < 64; i++, *in += 1, *out += 1)
 		(*out)[0] = BYTEORDER_FREE_LOAD32(*in);
 }
+
+/* Add decode costs calibrated at the first use if necessary */
+VSEPartitionConfig ResolveConfig(const VSEPartitionConfig& conf) {
+	return ResolveVSEPartitionConfig(conf, VSESIMPLE_LENS, NULL,
+			ARRAYSIZE(VSESIMPLE_LENS), true, VSESIMPLE_REMAPLOGS,
+			[](std::shared_ptr<VSEncodingPartitioner> p) {
+				return EncodingPtr(new VSEncodingSimple(p));
+			});
+}
+
 } /* namespace: */
 
 VSEncodingSimple::VSEncodingSimple() :
-		EncodingBase(E_VSESIMPLE), jtable_(INITIALIZE_SPTR(void *, MAXLEN)), vdp_(
-				new VSEncodingDP(VSESIMPLE_LENS,
-				NULL, ARRAYSIZE(VSESIMPLE_LENS), true)) {
+		EncodingBase(E_VSESIMPLE), vdp_(
+				CreateVSEPartitioner(VSESIMPLE_LENS,
+				NULL, ARRAYSIZE(VSESIMPLE_LENS), true,
+				ResolveConfig(GetVSEPartitionConfig()))) {
+}
+
+VSEncodingSimple::VSEncodingSimple(const VSEPartitionConfig& conf) :
+		EncodingBase(E_VSESIMPLE), vdp_(
+				CreateVSEPartitioner(VSESIMPLE_LENS,
+				NULL, ARRAYSIZE(VSESIMPLE_LENS), true, ResolveConfig(conf))) {
+}
+
+VSEncodingSimple::VSEncodingSimple(
+		std::shared_ptr<VSEncodingPartitioner> vdp) :
+		EncodingBase(E_VSESIMPLE), vdp_(
+				vdp) {
+	if (vdp == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid value: vdp");
 }
 
 VSEncodingSimple::~VSEncodingSimple() throw () {
 }
 
-void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
-		uint32_t *out, uint64_t *nvalue) const {
-	if (in == NULL)
-		THROW_ENCODING_EXCEPTION("Invalid input: in");
-	if (len == 0)
-		THROW_ENCODING_EXCEPTION("Invalid input: len");
-	if (out == NULL)
-		THROW_ENCODING_EXCEPTION("Invalid input: out");
-	if (*nvalue < 5)
-		THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+void VSEncodingSimple::encodeVS(const uint32_t *in, uint32_t len,
+		uint32_t *out, uint32_t *nvalue) const {
+	ASSERT(in != NULL);
+	ASSERT(len != 0);
+	ASSERT(out != NULL);
+
+	if (*nvalue < 3)
+		THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
 
 	ASSERT_ADDR(in, len);ASSERT_ADDR(out, *nvalue);
 
@@ -4721,7 +4744,7 @@ void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
 	std::vector<uint32_t> logs;
 	std::vector<uint32_t> parts;
 
-	for (uint64_t i = 0; i < len; i++)
+	for (uint32_t i = 0; i < len; i++)
 		logs.push_back(VSESIMPLE_REMAPLOGS[32 - MSB32(in[i])]);
 
 	ASSERT(logs.size() == len);
@@ -4739,6 +4762,8 @@ void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
 	// 一组(b,k)组成的tuple只需要一个Byte
 	// 因而这个offset大小是num个Byte，就是num/4个int
 	uint64_t offset = DIV_ROUNDUP(num, 4);
+	if (offset >= *nvalue)
+		THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
 
 	/* Ready to write data */
 	// wt1负责写入(k,b) tuple
@@ -4764,8 +4789,7 @@ void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
 		}
 
 		/* Write integers */
-		for (uint64_t j = parts[i]; j < parts[i + 1]; j++)
-			wt2.write_bits(in[j], maxB);
+		wt2.write_fixed_array(&in[parts[i]], parts[i + 1] - parts[i], maxB);
 
 		/* Align to 32-bit */
 		wt2.flush_bits();
@@ -4779,21 +4803,21 @@ void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
 	*nvalue = 2 + wt1.size() + wt2.size();
 }
 
-void VSEncodingSimple::decodeArray(const uint32_t *in, uint64_t len,
-		uint32_t *out, uint64_t nvalue) const {
-	if (in == NULL)
-		THROW_ENCODING_EXCEPTION("Invalid input: in");
-	if (len == 0)
-		THROW_ENCODING_EXCEPTION("Invalid input: len");
-	if (out == NULL)
-		THROW_ENCODING_EXCEPTION("Invalid input: out");
-	if (nvalue == 0)
-		THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+void VSEncodingSimple::decodeVS(const uint32_t *in, uint32_t len,
+		uint32_t *out, uint32_t nvalue) const {
+	ASSERT(in != NULL);
+	ASSERT(len != 0);
+	ASSERT(out != NULL);
+	ASSERT(nvalue != 0);
 
 	ASSERT_ADDR(in, len);ASSERT_ADDR(out, nvalue);
 
-	/* Get a working space */
-	void **jtable = jtable_.get();
+	/*
+	 * A jump table is filled with a window of descriptors at once,
+	 * so it stays small enough to be in L1 for any length of lists.
+	 */
+	void *jtable[VSESIMPLE_JTABLE_LEN + 1];
+	void **jp = jtable;
 
 	static void *VSESIMPLE_UNPACK[VSESIMPLE_LEN] = {
 	/* UNPACKER: 0 */
@@ -4930,52 +4954,63 @@ void VSEncodingSimple::decodeArray(const uint32_t *in, uint64_t len,
 	uint64_t num = BYTEORDER_FREE_LOAD64(in);
 	uint64_t offset = DIV_ROUNDUP(num, 4);
 
-	//
 	const uint32_t *data = in + offset + 2;
 	in += 2;
 
-	uint64_t numBlocks = num / 4;
-
 #define VSESIMPLE_DESC(__val__, __offset__) \
     (((__val__) >> VSESIMPLE_LOGDESC * __offset__) & (VSESIMPLE_LEN - 1))
 
-	for (uint64_t i = 0; i < numBlocks; i++, in++) {
-		uint32_t val = BYTEORDER_FREE_LOAD32(in);
-		// one tuple for one byte
-		jtable[i * 4] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 3)];
-		jtable[i * 4 + 1] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 2)];
-		jtable[i * 4 + 2] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 1)];
-		jtable[i * 4 + 3] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 0)];
-	}
+#define NEXT  \
+  if (UNLIKELY(out > oterm || data > iterm))  \
+    return; \
+  goto **jp++
+
+	/* step 2: Fill a jump table with a next window, and dispatch */
+	VSESIMPLE_REFILL: {
+		if (num == 0)
+			return;
+
+		uint64_t n = (num < VSESIMPLE_JTABLE_LEN) ?
+				num : VSESIMPLE_JTABLE_LEN;
+		uint64_t numBlocks = n / 4;
+
+		for (uint64_t i = 0; i < numBlocks; i++, in++) {
+			uint32_t val = BYTEORDER_FREE_LOAD32(in);
+			// one tuple for one byte
+			jtable[i * 4] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 3)];
+			jtable[i * 4 + 1] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 2)];
+			jtable[i * 4 + 2] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 1)];
+			jtable[i * 4 + 3] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 0)];
+		}
 
-	uint32_t rem = num % 4;
+		/* Only the last window has the rest */
+		uint32_t rem = n % 4;
 
-	if (rem != 0) {
-		uint32_t val = BYTEORDER_FREE_LOAD32(in);
+		if (rem != 0) {
+			uint32_t val = BYTEORDER_FREE_LOAD32(in);
 
-		switch (rem) {
-		case 3: {
-			jtable[4 * numBlocks + 2] =
-					VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 1)];
-		}
+			switch (rem) {
+			case 3: {
+				jtable[4 * numBlocks + 2] =
+						VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 1)];
+			}
 
-		case 2: {
-			jtable[4 * numBlocks + 1] =
-					VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 2)];
-		}
+			case 2: {
+				jtable[4 * numBlocks + 1] =
+						VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 2)];
+			}
 
-		case 1: {
-			jtable[4 * numBlocks] = VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 3)];
+			case 1: {
+				jtable[4 * numBlocks] =
+						VSESIMPLE_UNPACK[VSESIMPLE_DESC(val, 3)];
+			}
+			}
 		}
-		}
-	}
 
-	jtable[4 * numBlocks + rem] = &&VSESIMPLE_RET;
-
-#define NEXT  \
-  if (UNLIKELY(out > oterm || data > iterm))  \
-    return; \
-  goto **jtable++
+		jtable[n] = &&VSESIMPLE_RET;
+		jp = jtable;
+		num -= n;
+	}
 
 	/* Start point for decompression */
 	NEXT;
@@ -5524,13 +5559,86 @@ void VSEncodingSimple::decodeArray(const uint32_t *in, uint64_t len,
 	VSESIMPLE_U32_64: VSESIMPLE_UNPACK32_64(&out, &data);
 	NEXT;
 
-	/* Terminal point of threading */
-	VSESIMPLE_RET: return;
+	/* Terminal point of a window */
+	VSESIMPLE_RET: goto VSESIMPLE_REFILL;
+}
+
+void VSEncodingSimple::encodeArray(const uint32_t *in, uint64_t len,
+		uint32_t *out, uint64_t *nvalue) const {
+	if (in == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid input: in");
+	if (len == 0)
+		THROW_ENCODING_EXCEPTION("Invalid input: len");
+	if (out == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid input: out");
+	if (*nvalue < 5)
+		THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+	ASSERT_ADDR(in, len);ASSERT_ADDR(out, *nvalue);
+
+	/* Each chunk is encoded with its own descriptors */
+	uint64_t ntotal = 0;
+
+	while (len > 0) {
+		uint32_t n = (len < VSENCODING_BLOCKSZ) ? len : VSENCODING_BLOCKSZ;
+
+		if (*nvalue - ntotal < 4)
+			THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+		uint64_t left = *nvalue - ntotal - 1;
+		uint32_t csize = (left > UINT32_MAX) ?
+				UINT32_MAX : static_cast<uint32_t>(left);
+
+		encodeVS(in, n, out + 1, &csize);
+		BYTEORDER_FREE_STORE32(out, csize);
+
+		/* Move to next */
+		in += n, len -= n;
+		out += csize + 1;
+		ntotal += csize + 1;
+	}
+
+	*nvalue = ntotal;
+}
+
+void VSEncodingSimple::decodeArray(const uint32_t *in, uint64_t len,
+		uint32_t *out, uint64_t nvalue) const {
+	if (in == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid input: in");
+	if (len == 0)
+		THROW_ENCODING_EXCEPTION("Invalid input: len");
+	if (out == NULL)
+		THROW_ENCODING_EXCEPTION("Invalid input: out");
+	if (nvalue == 0)
+		THROW_ENCODING_EXCEPTION("Invalid input: nvalue");
+
+	ASSERT_ADDR(in, len);ASSERT_ADDR(out, nvalue);
+
+	const uint32_t *iterm = in + len;
+
+	while (nvalue > 0 && in < iterm) {
+		uint32_t n = (nvalue < VSENCODING_BLOCKSZ) ?
+				nvalue : VSENCODING_BLOCKSZ;
+		uint32_t csize = BYTEORDER_FREE_LOAD32(in);
+
+		if (csize == 0 || csize > static_cast<uint64_t>(iterm - in - 1))
+			THROW_ENCODING_EXCEPTION("Invalid value: in");
+
+		decodeVS(in + 1, csize, out, n);
+
+		/* Move to next */
+		in += csize + 1;
+		out += n, nvalue -= n;
+	}
 }
 
 uint64_t VSEncodingSimple::require(uint64_t len) const {
-	/* FIXME: Fill correct the required size */
-	return len + 5;
+	/*
+	 * Blocks of 1 integer take a descriptor each, and a chunk
+	 * has 3 more words for its size and # of blocks.
+	 */
+	return len + DIV_ROUNDUP(len, 4) +
+			3 * DIV_ROUNDUP(len, VSENCODING_BLOCKSZ) + 5;
 }
 
 } /* namespace: internals */
@@ -0,0 +1,103 @@
+/*-----------------------------------------------------------------------------
+ *  decMulti.cpp - Transformation tables that decode several Gamma/Delta
+ *                 codes in a single 16-bit lookup
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <compress/policy/decMulti.hpp>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+const uint32_t WINDOW = 16;
+
+/* Read [num] bits at [*pos] of a 16-bit window from MSB */
+uint32_t window_bits(uint32_t win, uint32_t *pos, uint32_t num) {
+  uint32_t val = (num == 0)? 0 :
+      (win >> (WINDOW - *pos - num)) & ((1U << num) - 1);
+  *pos += num;
+  return val;
+}
+
+/* Decode a gamma code in the window, or return false if it overruns */
+bool window_gamma(uint32_t win, uint32_t *pos, uint32_t *val) {
+  uint32_t count = 0;
+  while (*pos + count < WINDOW &&
+          ((win >> (WINDOW - 1 - *pos - count)) & 0x01) == 0)
+    count++;
+
+  if (*pos + 2 * count + 1 > WINDOW)
+    return false;
+
+  *pos += count + 1;
+  *val = ((1U << count) | window_bits(win, pos, count)) - 1;
+  return true;
+}
+
+bool window_delta(uint32_t win, uint32_t *pos, uint32_t *val) {
+  uint32_t p = *pos;
+  uint32_t count = 0;
+  if (!window_gamma(win, &p, &count) || p + count > WINDOW)
+    return false;
+
+  *val = ((1U << count) | window_bits(win, &p, count)) - 1;
+  *pos = p;
+  return true;
+}
+
+struct MultiTables {
+  MultiGammaEntry gamma[1 << WINDOW];
+  MultiDeltaEntry delta[1 << WINDOW];
+
+  MultiTables() {
+    for (uint32_t win = 0; win < (1U << WINDOW); win++) {
+      MultiGammaEntry& g = gamma[win];
+      uint32_t pos = 0;
+      uint32_t val = 0;
+      for (g.num = 0, g.bits = 0; g.num < MULTI_GAMMA_MAX &&
+              window_gamma(win, &pos, &val); g.num++) {
+        g.vals[g.num] = val;
+        g.bits = pos;
+      }
+
+      MultiDeltaEntry& d = delta[win];
+      pos = 0;
+      for (d.num = 0, d.bits = 0; d.num < MULTI_DELTA_MAX &&
+              window_delta(win, &pos, &val); d.num++) {
+        d.vals[d.num] = val;
+        d.bits = pos;
+      }
+    }
+  }
+};
+
+const MultiTables& multiTables() {
+  static MultiTables tables;
+  return tables;
+}
+
+} /* namespace: */
+
+const MultiGammaEntry *decMultiGamma() {
+  return multiTables().gamma;
+}
+
+const MultiDeltaEntry *decMultiDelta() {
+  return multiTables().delta;
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
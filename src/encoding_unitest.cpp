@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace integer_encoding;
 using namespace integer_encoding::internals;
 
@@ -131,6 +133,12 @@ TEST(IntegerEncodingInternals, FactoryTests) {
     EXPECT_EQ(typeid(VSEncodingSimple), typeid(*c));
   }
 
+  {
+    /* Encoder ID: E_ADAPTIVE */
+    EncodingPtr c = EncodingFactory::create(E_ADAPTIVE);
+    EXPECT_EQ(typeid(AdaptiveBlocks), typeid(*c));
+  }
+
   EXPECT_THROW(EncodingFactory::create(E_INVALID),
                encoding_exception);
 }
@@ -173,6 +181,1339 @@ TEST(IntegerEncodingInternals, BitsRWTests) {
   EXPECT_THROW(rd.read_bits(9), encoding_exception);
 }
 
+TEST(IntegerEncodingInternals, BitsWriterFixedTests) {
+  uint32_t  vals[100];
+  uint32_t  out1[101];
+  uint32_t  out2[101];
+
+  for (uint32_t b = 0; b <= 32; b++) {
+    for (uint32_t i = 0; i < 100; i++)
+      vals[i] = xor128();
+
+    BitsWriter wt1(out1, 101);
+    BitsWriter wt2(out2, 101);
+    wt1.write_bits(5, 3);
+    wt2.write_bits(5, 3);
+
+    for (uint32_t i = 0; i < 100; i++)
+      wt1.write_bits(vals[i], b);
+    wt2.write_fixed_array(vals, 100, b);
+    wt1.flush_bits();
+    wt2.flush_bits();
+
+    EXPECT_EQ(wt1.size(), wt2.size());
+    for (uint64_t i = 0; i < wt1.size(); i++)
+      EXPECT_EQ(out1[i], out2[i]);
+  }
+
+  /* Nothing is written if the space is not enough */
+  BitsWriter wt(out1, 2);
+  EXPECT_THROW(wt.write_fixed_array(vals, 3, 22), encoding_exception);
+  EXPECT_EQ(0, wt.size());
+}
+
+TEST(IntegerEncodingInternals, BitsReaderFastTests) {
+  const uint32_t  NUM = 4096;
+  uint32_t  vals[NUM];
+  uint32_t  nbits[NUM];
+  uint32_t  out[NUM + 1];
+
+  BitsWriter wt(out, NUM + 1);
+  for (uint32_t i = 0; i < NUM; i++) {
+    nbits[i] = xor128() % 33;
+    vals[i] = (nbits[i] == 0)? 0 : xor128() >> (32 - nbits[i]);
+    wt.write_bits(vals[i], nbits[i]);
+  }
+  wt.flush_bits();
+
+  /* Cross the boundary between unchecked reads and the tail */
+  BitsReader rd1(out, wt.size());
+  for (uint32_t i = 0; i < NUM; i++)
+    EXPECT_EQ(vals[i], rd1.read_bits(nbits[i]));
+  EXPECT_FALSE(rd1.unchecked());
+
+  BitsReader rd2(out, wt.size());
+  uint32_t i = 0;
+  for (; rd2.unchecked(); i++) {
+    EXPECT_EQ(vals[i], rd2.peek(nbits[i]));
+    rd2.consume(nbits[i]);
+  }
+  for (; i < NUM; i++)
+    EXPECT_EQ(vals[i], rd2.read_bits(nbits[i]));
+  EXPECT_THROW(rd2.read_bits(32), encoding_exception);
+}
+
+TEST(IntegerEncodingInternals, BitPackTests) {
+  uint32_t  src[128];
+  uint32_t  exp[129];
+  uint32_t  pck[129];
+  uint32_t  dec[128];
+
+  for (uint32_t b = 0; b <= 32; b++) {
+    uint32_t mask = (b < 32)? (1U << b) - 1 : 0xffffffff;
+
+    for (uint32_t j = 0; j < 128; j++)
+      src[j] = xor128();
+
+    /* The MSB order is the same as BitsWriter */
+    memset(exp, 0x00, sizeof(exp));
+    BitsWriter wt(exp, 129);
+    wt.write_fixed_array(src, 128, b);
+    wt.flush_bits();
+
+    memset(pck, 0x00, sizeof(pck));
+    BitPackKernels<BITPACK_MSB, 128, uint32_t>::pack[b](pck, src);
+    for (uint32_t j = 0; j < 129; j++)
+      EXPECT_EQ(exp[j], pck[j]);
+
+    BitPackKernels<BITPACK_MSB, 128, uint32_t>::unpack[b](dec, pck);
+    for (uint32_t j = 0; j < 128; j++)
+      EXPECT_EQ(src[j] & mask, dec[j]);
+
+    memset(dec, 0xff, sizeof(dec));
+    BitUnpackGroupKernels<BITPACK_MSB>::unpack[b](dec, pck, 128);
+    for (uint32_t j = 0; j < 128; j++)
+      EXPECT_EQ(src[j] & mask, dec[j]);
+
+    /* The LSB order puts a first value in the lowest bits */
+    memset(pck, 0x00, sizeof(pck));
+    BitPackKernels<BITPACK_LSB, 32, uint32_t>::pack[b](pck, src);
+    if (b > 0)
+      EXPECT_EQ(src[0] & mask, pck[0] & mask);
+
+    BitPackKernels<BITPACK_LSB, 32, uint32_t>::unpack[b](dec, pck);
+    for (uint32_t j = 0; j < 32; j++)
+      EXPECT_EQ(src[j] & mask, dec[j]);
+
+    /* The last value of 8 can span two words */
+    memset(pck, 0x00, sizeof(pck));
+    BitPackKernels<BITPACK_MSB, 8, uint32_t>::pack[b](pck, src);
+    BitPackKernels<BITPACK_MSB, 8, uint32_t>::unpack[b](dec, pck);
+    for (uint32_t j = 0; j < 8; j++)
+      EXPECT_EQ(src[j] & mask, dec[j]);
+
+    memset(pck, 0x00, sizeof(pck));
+    BitPackKernels<BITPACK_LSB, 8, uint32_t>::pack[b](pck, src);
+    BitPackKernels<BITPACK_LSB, 8, uint32_t>::unpack[b](dec, pck);
+    for (uint32_t j = 0; j < 8; j++)
+      EXPECT_EQ(src[j] & mask, dec[j]);
+
+    /* Narrow types for Compressor::encodeUint16() */
+    if (b <= 16) {
+      uint16_t  src16[16];
+      uint16_t  dec16[16];
+      for (uint32_t j = 0; j < 16; j++)
+        src16[j] = src[j] & mask;
+
+      memset(pck, 0x00, sizeof(pck));
+      BitPackKernels<BITPACK_LSB, 16, uint16_t>::pack[b](pck, src16);
+      BitPackKernels<BITPACK_LSB, 16, uint16_t>::unpack[b](dec16, pck);
+      for (uint32_t j = 0; j < 16; j++)
+        EXPECT_EQ(src16[j], dec16[j]);
+    }
+  }
+}
+
+namespace {
+
+/* Headers are decoded into a sequence of themselves */
+struct EchoOps {
+  const uint32_t  *hdr;
+  const uint32_t  *hterm;
+  std::vector<uint32_t> *out;
+
+  bool more() const {
+    return hdr < hterm;
+  }
+
+  uint32_t next() {
+    return *hdr++;
+  }
+
+  template <uint32_t H>
+  void decode() {
+    out->push_back(H);
+  }
+};
+
+} /* namespace: */
+
+TEST(IntegerEncodingInternals, ThreadedDecoderTests) {
+  uint32_t  hdrs[1024];
+  std::vector<uint32_t> out;
+
+  for (uint32_t j = 0; j < 1024; j++)
+    hdrs[j] = xor128() % 96;
+
+  EchoOps ops = { hdrs, hdrs + 1024, &out };
+  ThreadedDecoder<EchoOps, 96>::run(&ops);
+  EXPECT_EQ(hdrs + 1024, ops.hdr);
+  ASSERT_EQ(1024, out.size());
+  for (uint32_t j = 0; j < 1024; j++)
+    EXPECT_EQ(hdrs[j], out[j]);
+
+  /* A header out of range stops decoding there */
+  hdrs[512] = 96;
+  out.clear();
+  ops.hdr = hdrs;
+  EXPECT_THROW((ThreadedDecoder<EchoOps, 96>::run(&ops)),
+               encoding_exception);
+  EXPECT_EQ(hdrs + 513, ops.hdr);
+  EXPECT_EQ(512, out.size());
+
+  /* An empty sequence decodes nothing */
+  out.clear();
+  ops.hdr = ops.hterm;
+  ThreadedDecoder<EchoOps, 96>::run(&ops);
+  EXPECT_EQ(0, out.size());
+}
+
+TEST(IntegerEncodingInternals, KAFORKernelTests) {
+  uint32_t  src[128];
+  uint32_t  ref[144];
+  uint32_t  pck[144];
+  uint32_t  dec[128];
+
+  for (uint32_t i = 0; i < KAFOR_NUM_KERNELS; i++) {
+    const KAFORPackInfo &info = KAFORPackInfoArr[i];
+    uint32_t bw = ((i >> 2) & 31) + 1;
+    uint32_t mask = Compressor::mask_map[bw];
+
+    for (uint32_t j = 0; j < 128; j++)
+      src[j] = xor128();
+
+    /* Bits below the offset are owned by a previous frame */
+    memset(ref, 0x00, sizeof(ref));
+    for (uint32_t j = 0; j < 4; j++)
+      ref[j] = xor128() & ((1U << info.m_offset) - 1);
+
+    info.m_subFunc(ref, src);
+
+    for (int level = KAFOR_KERNEL_SCALAR;
+          level <= KAFORKernelLevel(); level++) {
+      memset(pck, 0x00, sizeof(pck));
+      memcpy(pck, ref, 16);
+      KAFORPackKernels(level)[i](pck, src);
+      for (uint32_t j = 0; j < info.m_wordSkipped + 4U; j++)
+        EXPECT_EQ(ref[j], pck[j]);
+
+      KAFORUnpackKernels(level)[i](dec, ref);
+      for (uint32_t j = 0; j < info.m_intEncoded; j++)
+        EXPECT_EQ(src[j] & mask, dec[j]);
+    }
+  }
+}
+
+TEST(IntegerEncodingInternals, GAFORTests) {
+  /* Lists have a tail shorter than 8 integers */
+  uint32_t len = 32 * 40 + 5;
+  std::vector<uint32_t> src(len);
+  for (uint32_t i = 0; i < len; i++)
+    src[i] = xor128() & ((1U << (xor128() % 20)) - 1);
+
+  AFOR afor;
+  std::vector<uint32_t> ref(2 * len + 16);
+  uint64_t rlen = ref.size();
+  afor.encodeArray(src.data(), len, ref.data(), &rlen);
+
+  uint32_t confs[][3] = {
+    {32, 8, 32}, {256, 8, 32}, {64, 16, 16}, {256, 32, 32}, {24, 8, 8},
+    {GAFOR_MAX_WINDOWSZ, 8, 32}
+  };
+
+  for (uint32_t c = 0; c < sizeof(confs) / sizeof(confs[0]); c++) {
+    GAFOR gafor(confs[c][0], confs[c][1], confs[c][2]);
+
+    std::vector<uint32_t> out(2 * len + 16);
+    uint64_t olen = out.size();
+    gafor.encodeArray(src.data(), len, out.data(), &olen);
+
+    /* Frames are chosen in a wider space than AFOR */
+    if (confs[c][1] == 8 && confs[c][2] == 32) {
+      if (confs[c][0] == 32)
+        EXPECT_EQ(rlen, olen);
+      else
+        EXPECT_GE(rlen, olen);
+    }
+
+    /* AFOR decodes them */
+    std::vector<uint32_t> dec(len);
+    afor.decodeArray(out.data(), olen, dec.data(), len);
+    for (uint32_t i = 0; i < len; i++)
+      EXPECT_EQ(src[i], dec[i]);
+  }
+
+  EXPECT_THROW(GAFOR(20), encoding_exception);
+  EXPECT_THROW(GAFOR(256, 4, 32), encoding_exception);
+  EXPECT_THROW(GAFOR(256, 32, 16), encoding_exception);
+}
+
+TEST(IntegerEncodingInternals, EncodingStatsTests) {
+  ResetEncodingStats();
+
+  EncodingStat st;
+  GetEncodingStat(STAT_AFOR_FRAMELEN, &st);
+  EXPECT_EQ(0ULL, st.count);
+
+  /* Counters of an exited thread are kept */
+  std::thread th([] {
+    for (uint32_t i = 0; i < 100; i++)
+      RecordEncodingStat(STAT_AFOR_FRAMELEN, 32);
+  });
+  th.join();
+
+  for (uint32_t i = 0; i < 10; i++)
+    RecordEncodingStat(STAT_AFOR_FRAMELEN, 8);
+  RecordEncodingStat(STAT_VSEDP_LOOPS, 0);
+
+  GetEncodingStat(STAT_AFOR_FRAMELEN, &st);
+  EXPECT_EQ(110ULL, st.count);
+  EXPECT_EQ(3280ULL, st.sum);
+  EXPECT_EQ(32ULL, st.max);
+  EXPECT_EQ(10ULL, st.hist[4]);
+  EXPECT_EQ(100ULL, st.hist[6]);
+
+  GetEncodingStat(STAT_VSEDP_LOOPS, &st);
+  EXPECT_EQ(1ULL, st.count);
+  EXPECT_EQ(1ULL, st.hist[0]);
+
+  EXPECT_THROW(GetEncodingStat(STAT_NUMS, &st), encoding_exception);
+
+  ResetEncodingStats();
+  GetEncodingStat(STAT_AFOR_FRAMELEN, &st);
+  EXPECT_EQ(0ULL, st.count);
+}
+
+TEST(IntegerEncodingInternals, SimdKernelTests) {
+  const SimdKernels& ref = GetSimdKernels(SIMD_SCALAR);
+
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; level++) {
+    const SimdKernels& k = GetSimdKernels(level);
+    EXPECT_LE(k.level, level);
+
+    /* Check lengths around the vector widths */
+    for (uint64_t n = 0; n < 100; n++) {
+      uint32_t  src[128] __attribute__((aligned(64)));
+      uint32_t  exp[128] __attribute__((aligned(64)));
+      uint32_t  out[128] __attribute__((aligned(64)));
+
+      for (uint32_t j = 0; j < 128; j++)
+        src[j] = xor128() & 0xffff;
+
+      k.copy(out, src, n);
+      for (uint64_t j = 0; j < n; j++)
+        EXPECT_EQ(src[j], out[j]);
+
+      k.zero(out, n);
+      for (uint64_t j = 0; j < n; j++)
+        EXPECT_EQ(0U, out[j]);
+
+      memcpy(exp, src, sizeof(src));
+      memcpy(out, src, sizeof(src));
+      EXPECT_EQ(ref.dgap(exp, n, n), k.dgap(out, n, n));
+      for (uint64_t j = 0; j < n; j++)
+        EXPECT_EQ(exp[j], out[j]);
+    }
+
+    /* A check value of CRC-32C, and chaining over a split */
+    EXPECT_EQ(0xe3069283, k.crc32c(0, "123456789", 9));
+    EXPECT_EQ(0xe3069283, k.crc32c(k.crc32c(0, "1234", 4), "56789", 5));
+
+    /* Unaligned heads and lengths over interleaved streams */
+    std::vector<uint8_t> buf(10000);
+    for (uint64_t j = 0; j < buf.size(); j++)
+      buf[j] = xor128();
+    for (uint64_t n = 0; n < buf.size(); n += 1 + n / 3)
+      EXPECT_EQ(ref.crc32c(7, buf.data() + n % 7, buf.size() - n),
+                k.crc32c(7, buf.data() + n % 7, buf.size() - n));
+  }
+}
+
+TEST(IntegerEncodingInternals, MultiDecTests) {
+  const MultiGammaEntry *gamma = decMultiGamma();
+  const MultiDeltaEntry *delta = decMultiDelta();
+
+  /* The first code of each entry must agree with single-code tables */
+  for (uint32_t win = 0; win < (1U << 16); win++) {
+    const MultiGammaEntry& g = gamma[win];
+    EXPECT_EQ(decGamma[win] == 0, g.num == 0);
+    if (g.num != 0)
+      EXPECT_EQ((decGamma[win] & 0xffff) - 1, g.vals[0]);
+    EXPECT_LE(g.bits, 16);
+
+    const MultiDeltaEntry& d = delta[win];
+    EXPECT_EQ(decDelta[win] == 0, d.num == 0);
+    if (d.num != 0)
+      EXPECT_EQ((decDelta[win] & 0xffff) - 1, d.vals[0]);
+    EXPECT_LE(d.bits, 16);
+  }
+}
+
+namespace {
+
+/* The original scanning DP, which VSEncodingDP must agree with */
+void ScanPartition(const std::vector<uint32_t>& seq,
+                   const uint32_t *lens, const uint32_t *zlens,
+                   uint32_t size, bool aligned, uint32_t fixedCost,
+                   std::vector<uint32_t> *parts) {
+  uint64_t mxblk = lens[size - 1];
+  if (zlens != NULL && mxblk < zlens[size - 1])
+    mxblk = zlens[size - 1];
+
+  std::vector<int64_t> sssp(seq.size() + 1, -1);
+  std::vector<uint64_t> costs(seq.size() + 1, 0);
+
+  for (uint64_t i = 1; i <= seq.size(); i++) {
+    int64_t mleft = (i > mxblk)? i - mxblk : 0;
+    uint32_t maxB = 0;
+
+    for (int64_t j = i - 1, l = 0, g = 0; j >= mleft; j--) {
+      if (maxB < seq[j])
+        maxB = seq[j];
+
+      if (zlens == NULL || maxB != 0) {
+        if (l >= size || i - j != lens[l])
+          continue;
+        l++;
+      } else {
+        if (l < size && i - j == lens[l])
+          l++;
+        if (g >= size || i - j != zlens[g])
+          continue;
+        g++;
+      }
+
+      uint64_t ccost = costs[j] + fixedCost + ((aligned)?
+          DIV_ROUNDUP((i - j) * maxB, 32) : (i - j) * maxB);
+      if (sssp[i] == -1)
+        costs[i] = ccost + 1;
+      if (ccost <= costs[i]) {
+        costs[i] = ccost;
+        sssp[i] = j;
+      }
+    }
+  }
+
+  parts->clear();
+  for (int64_t next = seq.size(); next != 0; next = sssp[next])
+    parts->insert(parts->begin(), next);
+  parts->insert(parts->begin(), 0);
+}
+
+} /* namespace: */
+
+TEST(IntegerEncodingInternals, VSEncodingDPTests) {
+  const uint32_t LENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14,
+                           16, 32, 64};
+  const uint32_t BLENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                            14, 15, 16};
+  const uint32_t ZLENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                            14, 16, 32};
+
+  for (int t = 0; t < 8; t++) {
+    /* Lots of runs of 0 to exercise zlens */
+    std::vector<uint32_t> seq(3000 + t);
+    for (uint64_t i = 0; i < seq.size(); i++)
+      seq[i] = (xor128() % 3 == 0)? xor128() % 33 : 0;
+
+    bool aligned = (t & 0x01);
+    std::vector<uint32_t> exp;
+    std::vector<uint32_t> parts;
+
+    VSEncodingDP dp1(LENS, NULL, ARRAYSIZE(LENS), aligned);
+    dp1.computePartition(seq, &parts, 8);
+    ScanPartition(seq, LENS, NULL, ARRAYSIZE(LENS), aligned, 8, &exp);
+    EXPECT_TRUE(exp == parts);
+
+    VSEncodingDP dp2(BLENS, ZLENS, ARRAYSIZE(BLENS), aligned);
+    dp2.computePartition(seq, &parts, 9);
+    ScanPartition(seq, BLENS, ZLENS, ARRAYSIZE(BLENS), aligned, 9, &exp);
+    EXPECT_TRUE(exp == parts);
+  }
+}
+
+namespace {
+
+/* Check that every block has an admissible length */
+bool ValidPartition(const std::vector<uint32_t>& seq,
+                    const std::vector<uint32_t>& parts,
+                    const uint32_t *lens, const uint32_t *zlens,
+                    uint32_t size) {
+  if (parts.size() < 2 || parts.front() != 0 || parts.back() != seq.size())
+    return false;
+
+  for (uint64_t i = 0; i < parts.size() - 1; i++) {
+    uint32_t len = parts[i + 1] - parts[i];
+    bool zero = true;
+    for (uint32_t j = parts[i]; j < parts[i + 1]; j++)
+      zero = zero && (seq[j] == 0);
+
+    const uint32_t *t = (zero && zlens != NULL)? zlens : lens;
+    if (std::find(t, t + size, len) == t + size)
+      return false;
+  }
+
+  return true;
+}
+
+} /* namespace: */
+
+TEST(IntegerEncodingInternals, VSEncodingPartitionerTests) {
+  const uint32_t BLENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                            14, 15, 16};
+  const uint32_t ZLENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                            14, 16, 32};
+
+  VSEPartitionConfig conf;
+  EXPECT_TRUE(ParseVSEPartitionConfig("greedy", &conf));
+  EXPECT_EQ(VSE_PARTITION_GREEDY, conf.policy);
+  EXPECT_TRUE(ParseVSEPartitionConfig("approx:0.1:0.5", &conf));
+  EXPECT_EQ(VSE_PARTITION_APPROX, conf.policy);
+  EXPECT_DOUBLE_EQ(0.1, conf.eps1);
+  EXPECT_DOUBLE_EQ(0.5, conf.eps2);
+  EXPECT_FALSE(ParseVSEPartitionConfig("approx:2.0:0.5", &conf));
+  EXPECT_FALSE(ParseVSEPartitionConfig("optimal", &conf));
+
+  const VSEPartitionConfig confs[] = {
+    VSEPartitionConfig(VSE_PARTITION_EXACT),
+    VSEPartitionConfig(VSE_PARTITION_APPROX),
+    VSEPartitionConfig(VSE_PARTITION_GREEDY)
+  };
+
+  std::vector<uint32_t> seq(5000);
+  for (uint64_t i = 0; i < seq.size(); i++)
+    seq[i] = (xor128() % 3 == 0)? xor128() % 33 : 0;
+
+  std::vector<uint32_t> data(seq.size());
+  for (uint64_t i = 0; i < seq.size(); i++)
+    data[i] = (seq[i] == 0)? 0 : xor128() & ((1U << (seq[i] % 24)) - 1);
+
+  for (uint32_t k = 0; k < ARRAYSIZE(confs); k++) {
+    std::vector<uint32_t> parts;
+
+    std::shared_ptr<VSEncodingPartitioner> p = CreateVSEPartitioner(
+        BLENS, ZLENS, ARRAYSIZE(BLENS), false, confs[k]);
+    p->computePartition(seq, &parts, 9);
+    EXPECT_TRUE(ValidPartition(seq, parts, BLENS, ZLENS,
+                               ARRAYSIZE(BLENS)));
+
+    /* Round trip through the codecs with each policy */
+    std::shared_ptr<EncodingBase> codecs[] = {
+      std::shared_ptr<EncodingBase>(new VSEncodingBlocks(confs[k])),
+      std::shared_ptr<EncodingBase>(new VSEncodingRest(confs[k])),
+      std::shared_ptr<EncodingBase>(new VSEncodingSimple(confs[k]))
+    };
+
+    for (uint32_t c = 0; c < ARRAYSIZE(codecs); c++) {
+      uint64_t nvalue = codecs[c]->require(data.size());
+      std::vector<uint32_t> out(nvalue);
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+
+      EXPECT_NO_THROW(codecs[c]->encodeArray(data.data(), data.size(),
+                                             out.data(), &nvalue));
+      EXPECT_NO_THROW(codecs[c]->decodeArray(out.data(), nvalue,
+                                             dec.data(), data.size()));
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+    }
+  }
+}
+
+TEST(IntegerEncodingInternals, VSEDecodeCostTests) {
+  const uint32_t LENS[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14,
+                           16, 32, 64};
+
+  std::vector<uint32_t> seq(5000);
+  for (uint64_t i = 0; i < seq.size(); i++)
+    seq[i] = xor128() % 13;
+
+  /* A flat cost per block makes partitions have fewer blocks */
+  std::shared_ptr<VSEDecodeCost> dcost(new VSEDecodeCost());
+  for (uint32_t b = 0; b < VSE_MAX_LOGS; b++)
+    for (uint32_t k = 0; k < ARRAYSIZE(LENS); k++)
+      dcost->set(b, k, 10.0);
+
+  VSEPartitionConfig conf;
+  std::vector<uint32_t> parts1;
+  std::vector<uint32_t> parts2;
+
+  CreateVSEPartitioner(LENS, NULL, ARRAYSIZE(LENS), false, conf)->
+      computePartition(seq, &parts1, 8);
+
+  conf.lambda = 4.0;
+  conf.dcost = dcost;
+  CreateVSEPartitioner(LENS, NULL, ARRAYSIZE(LENS), false, conf)->
+      computePartition(seq, &parts2, 8);
+
+  EXPECT_LT(parts2.size(), parts1.size());
+  EXPECT_TRUE(ValidPartition(seq, parts2, LENS, NULL, ARRAYSIZE(LENS)));
+
+  /* Costs survive a round trip through a file */
+  VSEDecodeCost loaded;
+  EXPECT_TRUE(dcost->save(".vse_dcost_test"));
+  EXPECT_TRUE(loaded.load(".vse_dcost_test"));
+  EXPECT_DOUBLE_EQ(10.0, loaded.get(7, 3));
+  remove(".vse_dcost_test");
+
+  /* Codecs calibrate their own costs without given ones */
+  conf.dcost.reset();
+  VSEncodingRest c(conf);
+
+  std::vector<uint32_t> data(3000);
+  for (uint64_t i = 0; i < data.size(); i++)
+    data[i] = xor128() & ((1U << (i % 17)) - 1);
+
+  uint64_t nvalue = c.require(data.size());
+  std::vector<uint32_t> out(nvalue);
+  std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+
+  c.encodeArray(data.data(), data.size(), out.data(), &nvalue);
+  c.decodeArray(out.data(), nvalue, dec.data(), data.size());
+  EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+}
+
+TEST(IntegerEncodingInternals, VSEncodingRestReadOnlyTests) {
+  VSEncodingRest c;
+
+  /* Odd widths leave paddings that the decoder restores words from */
+  std::vector<uint32_t> data(10000);
+  for (uint64_t i = 0; i < data.size(); i++)
+    data[i] = xor128() & ((1U << (i / 7 % 21)) - 1);
+
+  uint64_t nvalue = 2 * c.require(data.size()) + 128;
+  std::vector<uint32_t> out(nvalue);
+  c.encodeArray(data.data(), data.size(), out.data(), &nvalue);
+  out.resize(nvalue);
+
+  /* Decode the same buffer twice, and it must not be changed */
+  const std::vector<uint32_t> orig(out);
+  for (int t = 0; t < 2; t++) {
+    std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+    c.decodeArray(out.data(), nvalue, dec.data(), data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+    EXPECT_TRUE(orig == out);
+  }
+}
+
+TEST(IntegerEncodingInternals, VSERWidthClassTests) {
+  VSE_R c;
+
+  /* Every width class, including the widest one and runs of 0 */
+  std::vector<uint32_t> data(5000);
+  for (uint64_t i = 0; i < data.size(); i++) {
+    uint32_t l = i / 3 % 33;
+    data[i] = (l == 32)? UINT32_MAX - 1 : xor128() & ((1ULL << l) - 1);
+  }
+
+  uint64_t nvalue = 2 * data.size() + 128;
+  std::vector<uint32_t> out(nvalue);
+  c.encodeArray(data.data(), data.size(), out.data(), &nvalue);
+
+  /* An exact-size input makes overreads visible to sanitizers */
+  std::vector<uint32_t> in(out.begin(), out.begin() + nvalue);
+  std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+  c.decodeArray(in.data(), in.size(), dec.data(), data.size());
+  EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+}
+
+TEST(IntegerEncodingInternals, AdaptiveBlocksTests) {
+  /* Dense runs, regular gaps and spikes over 28 bits in a list */
+  std::vector<uint32_t> data(10000 + 77);
+  for (uint64_t i = 0; i < data.size(); i++) {
+    switch (i / 1000 % 3) {
+      case 0: data[i] = 0; break;
+      case 1: data[i] = 17 + (xor128() & 3); break;
+      default: data[i] = (i % 97 == 0)? xor128() | (1U << 30) :
+          xor128() & 255; break;
+    }
+  }
+
+  AdaptiveBlocks c1;
+  AdaptiveBlocks c2(ADAPTIVE_BLOCKSZ, 1.0);
+  uint64_t nvalue[2];
+
+  for (int t = 0; t < 2; t++) {
+    AdaptiveBlocks& c = (t == 0)? c1 : c2;
+    nvalue[t] = c.require(data.size());
+    std::vector<uint32_t> out(nvalue[t]);
+    std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+
+    c.encodeArray(data.data(), data.size(), out.data(), &nvalue[t]);
+    c.decodeArray(out.data(), nvalue[t], dec.data(), data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+  }
+
+  /* A budget trades space for decoding speed */
+  EXPECT_LE(nvalue[0], nvalue[1]);
+  EXPECT_THROW(AdaptiveBlocks(ADAPTIVE_MAX_BLOCKSZ + 1),
+               encoding_exception);
+}
+
+TEST(IntegerEncodingInternals, VSEncodingBlocksParallelTests) {
+  VSEncodingBlocks c;
+
+  /* Cover a partial last chunk and a list of one chunk */
+  const uint64_t lens[] = {4 * VSENCODING_BLOCKSZ + 777, 1000};
+
+  for (uint32_t t = 0; t < ARRAYSIZE(lens); t++) {
+    std::vector<uint32_t> data(lens[t]);
+    for (uint64_t i = 0; i < data.size(); i++)
+      data[i] = (xor128() % 4 == 0)? 0 : xor128() & ((1U << (i % 20)) - 1);
+
+    uint64_t n1 = c.require(data.size());
+    uint64_t n2 = n1;
+    std::vector<uint32_t> out1(n1);
+    std::vector<uint32_t> out2(n2);
+
+    c.encodeArray(data.data(), data.size(), out1.data(), &n1);
+    c.encodeArrayParallel(data.data(), data.size(), out2.data(), &n2, 4);
+    EXPECT_EQ(n1, n2);
+    EXPECT_TRUE(std::equal(out1.begin(), out1.begin() + n1, out2.begin()));
+
+    std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+    c.decodeArray(out2.data(), n2, dec.data(), data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+  }
+}
+
+TEST(IntegerEncodingInternals, AppendArrayTests) {
+  std::vector<EncodingPtr> codecs;
+  const int policies[] = {
+    E_P4D, E_OPTP4D, E_VSEBLOCKS, E_KAFOR, E_AFOR,
+    E_VARIABLEBYTE, E_SIMPLE16
+  };
+  for (uint32_t k = 0; k < ARRAYSIZE(policies); k++)
+    codecs.push_back(EncodingFactory::create(policies[k]));
+  codecs.push_back(EncodingPtr(new GAFOR(64, 8, 32)));
+
+  /* Tails of none, some and all blocks, and a list of a block */
+  const uint64_t lens[][2] = {
+    {1, 1}, {5, 200}, {32, 32}, {127, 1}, {128, 128}, {300, 77},
+    {1000, 5000}, {VSENCODING_BLOCKSZ, 5}, {VSENCODING_BLOCKSZ + 10, 300}
+  };
+
+  for (uint32_t t = 0; t < ARRAYSIZE(lens); t++) {
+    uint64_t num = lens[t][0];
+    uint64_t addlen = lens[t][1];
+
+    std::vector<uint32_t> data(num + addlen);
+    for (uint64_t i = 0; i < data.size(); i++)
+      data[i] = xor128() & ((1U << (i / 64 % 20)) - 1);
+
+    for (uint32_t k = 0; k < codecs.size(); k++) {
+      EncodingPtr c = codecs[k];
+
+      /* AFOR and KAFOR count bytes, so buffers are zeroed and wide */
+      uint64_t room = 4 * data.size() + 1024;
+      std::vector<uint32_t> ref(room);
+      std::vector<uint32_t> old(room);
+      std::vector<uint32_t> out(room);
+
+      uint64_t rlen = room;
+      c->encodeArray(data.data(), data.size(), ref.data(), &rlen);
+
+      uint64_t olen = room;
+      c->encodeArray(data.data(), num, old.data(), &olen);
+
+      uint64_t nlen = room;
+      c->appendArray(old.data(), olen, num, data.data() + num, addlen,
+                     out.data(), &nlen);
+
+      /* Appending gives the same with encoding at once */
+      EXPECT_EQ(rlen, nlen);
+      EXPECT_TRUE(std::equal(ref.begin(), ref.begin() + rlen, out.begin()));
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+      c->decodeArray(out.data(), nlen, dec.data(), data.size());
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+    }
+  }
+}
+
+TEST(IntegerEncodingInternals, ChunkedEncodingTests) {
+  const int policies[] = {E_VARIABLEBYTE, E_P4D, E_VSEBLOCKS, E_SIMPLE16};
+
+  /* Small chunks and a partial last one to have many chunks */
+  std::vector<uint32_t> data(40 * 1024 + 333);
+  for (uint64_t i = 0; i < data.size(); i++)
+    data[i] = xor128() & ((1U << (i % 13)) - 1);
+
+  std::vector<uint32_t> sorted(data);
+  GetSimdKernels().dgap(sorted.data(), sorted.size(), 7);
+
+  /* Chunks MUST be longer than overruns of decoders */
+  EXPECT_THROW(ChunkedEncoding(EncodingFactory::create(E_P4D),
+                               CHUNKED_MIN_LEN - 1), encoding_exception);
+
+  for (uint32_t p = 0; p < ARRAYSIZE(policies); p++) {
+    ChunkedEncoding c(EncodingFactory::create(policies[p]), 1024);
+
+    uint64_t nvalue = c.require(data.size());
+    std::vector<uint32_t> out(nvalue);
+    std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+
+    c.encodeArray(data.data(), data.size(), out.data(), &nvalue);
+
+    c.decodeArray(out.data(), nvalue, dec.data(), data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+
+    std::fill(dec.begin(), dec.end(), 0);
+    c.decodeParallel(out.data(), nvalue, dec.data(), data.size(), 4);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+
+    std::fill(dec.begin(), dec.end(), 0);
+    c.decodeSortedParallel(out.data(), nvalue,
+                           dec.data(), data.size(), 7, 3);
+    EXPECT_TRUE(std::equal(sorted.begin(), sorted.end(), dec.begin()));
+  }
+}
+
+TEST(IntegerEncodingInternals, ListContainerTests) {
+  const char *filename = "./.listcontainer_utest.tmp";
+  const int policies[] = {E_VARIABLEBYTE, E_P4D, E_VSEBLOCKS, E_AFOR};
+
+  /* Lists with their own codecs, and an empty one */
+  std::vector<std::vector<uint32_t> > lists(37);
+  for (uint64_t i = 0; i < lists.size(); i++) {
+    lists[i].resize((i == 5)? 0 : xor128() % 3000 + 1);
+    for (uint64_t j = 0; j < lists[i].size(); j++)
+      lists[i][j] = xor128() & ((1U << (i % 20)) - 1);
+  }
+
+  {
+    ListContainerWriter w(filename);
+    for (uint64_t i = 0; i < lists.size(); i++) {
+      int id = policies[i % ARRAYSIZE(policies)];
+      EncodingPtr c = EncodingFactory::create(id);
+
+      uint64_t nvalue = 0;
+      std::vector<uint32_t> out(c->require(lists[i].size()) + 1);
+      if (!lists[i].empty()) {
+        nvalue = out.size();
+        c->encodeArray(lists[i].data(), lists[i].size(),
+                       out.data(), &nvalue);
+      }
+
+      EXPECT_EQ(i, w.append(id, lists[i].size(), i * 7,
+                            out.data(), nvalue));
+    }
+    w.close();
+  }
+
+  {
+    ListContainerReader rd(filename);
+    ASSERT_EQ(lists.size(), rd.size());
+    EXPECT_EQ(0U, rd.verifyAll());
+
+    /* Lists are located in any order */
+    for (uint64_t i = lists.size(); i-- > 0;) {
+      ListEntry e = rd.entry(i);
+      EXPECT_EQ(policies[i % ARRAYSIZE(policies)], e.codec);
+      EXPECT_EQ(i * 7, e.base);
+      ASSERT_EQ(lists[i].size(), e.num);
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(e.num));
+      rd.decode(i, dec.data(), true);
+      EXPECT_TRUE(std::equal(lists[i].begin(), lists[i].end(),
+                             dec.begin()));
+    }
+  }
+
+  /* Read the file image to break it */
+  std::vector<uint32_t> image;
+  {
+    FILE *fp = fopen(filename, "r");
+    ASSERT_TRUE(fp != NULL);
+    fseeko(fp, 0, SEEK_END);
+    image.resize(ftello(fp) / 4);
+    fseeko(fp, 0, SEEK_SET);
+    EXPECT_EQ(image.size(), fread(image.data(), 4, image.size(), fp));
+    fclose(fp);
+  }
+
+  remove(filename);
+
+  uint64_t size = image.size() * 4;
+  ListContainerReader rd(image.data(), size);
+  ListEntry e = rd.entry(3);
+  std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(e.num));
+
+  /* A broken payload is caught only if verified */
+  image[e.offset + e.len / 2] ^= 0x10;
+  EXPECT_FALSE(rd.verify(3));
+  EXPECT_TRUE(rd.verify(4));
+  EXPECT_EQ(1U, rd.verifyAll());
+  EXPECT_THROW(rd.decode(3, dec.data(), true), encoding_exception);
+  image[e.offset + e.len / 2] ^= 0x10;
+
+  /* So is a broken directory */
+  image[image.size() - 10] ^= 0x01;
+  EXPECT_FALSE(rd.verifyDirectory());
+  image[image.size() - 10] ^= 0x01;
+  EXPECT_TRUE(rd.verifyDirectory());
+
+  /* Broken headers and truncated files are never read */
+  image[4] ^= 0x01;
+  EXPECT_THROW(ListContainerReader(image.data(), size), encoding_exception);
+  image[4] ^= 0x01;
+  EXPECT_THROW(ListContainerReader(image.data(), size - 4),
+               encoding_exception);
+  EXPECT_FALSE(ListContainerReader::Probe(image.data() + 1, size - 4));
+}
+
+TEST(IntegerEncodingInternals, ListFetcherTests) {
+  const char *filename = "./.listcontainer_utest.tmp";
+
+  std::vector<std::vector<uint32_t> > lists(50);
+  for (uint64_t i = 0; i < lists.size(); i++) {
+    lists[i].resize((i == 7)? 0 : xor128() % 3000 + 1);
+    for (uint64_t j = 0; j < lists[i].size(); j++)
+      lists[i][j] = xor128() & ((1U << (i % 20)) - 1);
+  }
+
+  EncodingPtr c = EncodingFactory::create(E_P4D);
+  {
+    ListContainerWriter w(filename, LIST_CONTAINER_ALIGN_PAGE);
+    for (uint64_t i = 0; i < lists.size(); i++) {
+      std::vector<uint32_t> out(c->require(lists[i].size()) + 1);
+      uint64_t nvalue = 0;
+      if (!lists[i].empty()) {
+        nvalue = out.size();
+        c->encodeArray(lists[i].data(), lists[i].size(),
+                       out.data(), &nvalue);
+      }
+      w.append(E_P4D, lists[i].size(), i, out.data(), nvalue);
+    }
+    w.close();
+  }
+
+  /* A batch in any order, and with duplicates */
+  std::vector<uint64_t> ids;
+  for (uint64_t i = lists.size(); i-- > 0;)
+    ids.push_back((i * 7) % lists.size());
+  ids.push_back(3);
+
+  /* Both io_uring (if any) and threads of pread */
+  for (int mode = 0; mode < 2; mode++) {
+    if (mode == 1)
+      setenv(AIO_MODE_ENV, "pread", 1);
+
+    ListFetcher f(filename, 8, 4);
+    ASSERT_EQ(lists.size(), f.size());
+    EXPECT_EQ(LIST_CONTAINER_ALIGN_PAGE, f.alignment());
+    if (mode == 1)
+      EXPECT_FALSE(f.async());
+
+    std::vector<int> seen(ids.size(), 0);
+    f.fetch(ids.data(), ids.size(),
+            [&](uint64_t k, const ListEntry& e, const uint32_t *list) {
+      const std::vector<uint32_t>& l = lists[ids[k]];
+      EXPECT_EQ(ids[k], e.base);
+      EXPECT_EQ(l.size(), e.num);
+      EXPECT_TRUE(std::equal(l.begin(), l.end(), list));
+      seen[k]++;
+    }, true);
+
+    for (uint64_t k = 0; k < ids.size(); k++)
+      EXPECT_EQ(1, seen[k]);
+    EXPECT_THROW(f.entry(lists.size()), encoding_exception);
+  }
+
+  /* A broken payload is caught only if verified */
+  {
+    ListFetcher f(filename);
+    ListEntry e = f.entry(10);
+
+    FILE *fp = fopen(filename, "r+");
+    ASSERT_TRUE(fp != NULL);
+    fseeko(fp, e.offset * 4, SEEK_SET);
+    int b = fgetc(fp);
+    fseeko(fp, e.offset * 4, SEEK_SET);
+    fputc(b ^ 0x10, fp);
+    fclose(fp);
+
+    uint64_t id = 10;
+    auto nop = [](uint64_t, const ListEntry&, const uint32_t *) {};
+    EXPECT_THROW(f.fetch(&id, 1, nop, true), encoding_exception);
+  }
+
+  unsetenv(AIO_MODE_ENV);
+  remove(filename);
+}
+
+TEST(IntegerEncodingInternals, PrefetchTests) {
+  PrefetchConfig conf;
+  EXPECT_TRUE(ParsePrefetchConfig("8:2", &conf));
+  EXPECT_EQ(8U, conf.lists);
+  EXPECT_EQ(2U, conf.blocks);
+  EXPECT_TRUE(ParsePrefetchConfig("0:0", &conf));
+  EXPECT_FALSE(ParsePrefetchConfig("8", &conf));
+  EXPECT_FALSE(ParsePrefetchConfig(":2", &conf));
+  EXPECT_FALSE(ParsePrefetchConfig("8:2x", &conf));
+  EXPECT_FALSE(ParsePrefetchConfig(NULL, &conf));
+
+  const PrefetchConfig saved = GetPrefetchConfig();
+  const int policies[] = {E_P4D, E_VSEBLOCKS, E_KAFOR};
+  const char *dists[] = {"0:0", "1:1", "16:64"};
+
+  std::vector<uint32_t> data(200000);
+  for (uint64_t i = 0; i < data.size(); i++)
+    data[i] = xor128() & ((1U << (i / 4096 % 20)) - 1);
+
+  /* Decoders give the same values with any distance */
+  for (uint32_t k = 0; k < ARRAYSIZE(policies); k++) {
+    EncodingPtr c = EncodingFactory::create(policies[k]);
+
+    std::vector<uint32_t> out(c->require(data.size()) + 1);
+    uint64_t nvalue = out.size();
+    c->encodeArray(data.data(), data.size(), out.data(), &nvalue);
+
+    for (uint32_t d = 0; d < ARRAYSIZE(dists); d++) {
+      ASSERT_TRUE(ParsePrefetchConfig(dists[d], &conf));
+      SetPrefetchConfig(conf);
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+      c->decodeArray(out.data(), nvalue, dec.data(), data.size());
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+    }
+  }
+
+  SetPrefetchConfig(saved);
+}
+
+TEST(IntegerEncodingInternals, HugePageTests) {
+  const bool saved = IsHugePageEnabled();
+
+  /* Small buffers come from new[] anyway */
+  SetHugePageEnabled(true);
+  bool huge = true;
+  void *small = AllocBuffer(4096, &huge);
+  EXPECT_FALSE(huge);
+  FreeBuffer(small, 4096, huge);
+
+  /* Large ones are aligned to huge pages and writable */
+  const uint64_t n = (2 * HUGEPAGE_SZ + 100) / sizeof(uint32_t);
+  std::shared_ptr<uint32_t> buf = MakeBuffer<uint32_t>(n);
+  ASSERT_TRUE(buf.get() != NULL);
+  EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(buf.get()) % HUGEPAGE_SZ);
+  for (uint64_t i = 0; i < n; i++)
+    buf.get()[i] = i;
+  EXPECT_EQ(n - 1, buf.get()[n - 1]);
+
+  /* Codecs with internal buffers give the same values either way */
+  std::vector<uint32_t> data(1000000);
+  for (uint64_t i = 0; i < data.size(); i++)
+    data[i] = xor128() & ((1U << (i / 4096 % 20)) - 1);
+
+  const int policies[] = {E_VSEBLOCKS, E_VSEREST};
+  for (uint32_t k = 0; k < ARRAYSIZE(policies); k++) {
+    EncodingPtr c = EncodingFactory::create(policies[k]);
+
+    for (int h = 0; h < 2; h++) {
+      SetHugePageEnabled(h != 0);
+
+      std::vector<uint32_t> out(c->require(data.size()) + 1);
+      uint64_t nvalue = out.size();
+      c->encodeArray(data.data(), data.size(), out.data(), &nvalue);
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(data.size()));
+      c->decodeArray(out.data(), nvalue, dec.data(), data.size());
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), dec.begin()));
+    }
+  }
+
+  SetHugePageEnabled(saved);
+}
+
+TEST(IntegerEncodingInternals, ListContainerAlignmentTests) {
+  const char *filename = "./.listcontainer_utest.tmp";
+  const uint32_t aligns[] = {
+    LIST_CONTAINER_ALIGN_SIMD,
+    LIST_CONTAINER_ALIGN_LINE,
+    LIST_CONTAINER_ALIGN_PAGE
+  };
+
+  EXPECT_THROW(ListContainerWriter(filename, 8), encoding_exception);
+
+  /* Small and large lists in turn */
+  std::vector<std::vector<uint32_t> > lists(64);
+  for (uint64_t i = 0; i < lists.size(); i++) {
+    lists[i].resize((i & 1)? xor128() % 12 + 1 : xor128() % 3000 + 1);
+    for (uint64_t j = 0; j < lists[i].size(); j++)
+      lists[i][j] = xor128() & ((1U << (i % 20)) - 1);
+  }
+
+  EncodingPtr c = EncodingFactory::create(E_VARIABLEBYTE);
+
+  for (uint32_t k = 0; k < ARRAYSIZE(aligns); k++) {
+    uint32_t align = aligns[k];
+    uint64_t total = 0;
+    uint64_t nlarge = 0;
+
+    {
+      ListContainerWriter w(filename, align);
+      for (uint64_t i = 0; i < lists.size(); i++) {
+        std::vector<uint32_t> out(c->require(lists[i].size()));
+        uint64_t nvalue = out.size();
+        c->encodeArray(lists[i].data(), lists[i].size(),
+                       out.data(), &nvalue);
+        w.append(E_VARIABLEBYTE, lists[i].size(), 0,
+                 out.data(), nvalue);
+
+        total += nvalue * 4;
+        if (nvalue * 4 >= align)
+          nlarge++;
+      }
+      w.close();
+    }
+
+    ListContainerReader rd(filename);
+    ASSERT_EQ(align, rd.alignment());
+    EXPECT_EQ(0U, rd.verifyAll());
+
+    std::vector<std::pair<uint64_t, uint64_t> > spans;
+    for (uint64_t i = 0; i < rd.size(); i++) {
+      ListEntry e = rd.entry(i);
+      uint64_t off = e.offset * 4;
+      uint64_t len = uint64_t(e.len) * 4;
+
+      /* Large lists start at boundaries, and small ones stay in */
+      if (len >= align)
+        EXPECT_EQ(0U, off % align);
+      else
+        EXPECT_EQ(off / align, (off + len - 1) / align);
+      spans.push_back(std::make_pair(off, off + len));
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(e.num));
+      rd.decode(i, dec.data(), true);
+      EXPECT_TRUE(std::equal(lists[i].begin(), lists[i].end(),
+                             dec.begin()));
+    }
+
+    /* Lists in gaps never overlap, and padding is bounded */
+    std::sort(spans.begin(), spans.end());
+    for (uint64_t i = 1; i < spans.size(); i++)
+      EXPECT_LE(spans[i - 1].second, spans[i].first);
+    EXPECT_LE(spans.back().second,
+              LIST_CONTAINER_HEADER_SZ + total + (nlarge + 1) * align);
+
+    remove(filename);
+  }
+}
+
+TEST(IntegerEncodingInternals, ListContainerAppenderTests) {
+  const char *src = "./.listcontainer_utest.tmp";
+  const char *dst = "./.listcontainer_utest2.tmp";
+  const int policies[] = {E_P4D, E_VSEBLOCKS, E_KAFOR, E_AFOR};
+
+  /* Lists with their own codecs, and an empty one */
+  std::vector<std::vector<uint32_t> > lists(16);
+  for (uint64_t i = 0; i < lists.size(); i++) {
+    lists[i].resize((i == 5)? 0 : xor128() % 3000 + 1);
+    for (uint64_t j = 0; j < lists[i].size(); j++)
+      lists[i][j] = xor128() & ((1U << (i % 20)) - 1);
+  }
+
+  {
+    ListContainerWriter w(src, LIST_CONTAINER_ALIGN_LINE);
+    for (uint64_t i = 0; i < lists.size(); i++) {
+      int id = policies[i % ARRAYSIZE(policies)];
+      EncodingPtr c = EncodingFactory::create(id);
+
+      uint64_t nvalue = 0;
+      std::vector<uint32_t> out(c->require(lists[i].size()) + 1);
+      if (!lists[i].empty()) {
+        nvalue = out.size();
+        c->encodeArray(lists[i].data(), lists[i].size(),
+                       out.data(), &nvalue);
+      }
+      w.append(id, lists[i].size(), i, out.data(), nvalue);
+    }
+    w.close();
+  }
+
+  /* Append to even lists in two pieces, and add a list */
+  std::vector<uint32_t> added(777);
+  for (uint64_t j = 0; j < added.size(); j++)
+    added[j] = xor128() & 0xffff;
+
+  {
+    ListContainerAppender ap(src, dst);
+    for (uint64_t i = 0; i < lists.size(); i += 2) {
+      std::vector<uint32_t> more(xor128() % 500 + 100);
+      for (uint64_t j = 0; j < more.size(); j++)
+        more[j] = xor128() & 0xfff;
+
+      ap.append(i, more.data(), 100);
+      ap.append(i, more.data() + 100, more.size() - 100);
+      lists[i].insert(lists[i].end(), more.begin(), more.end());
+    }
+
+    EXPECT_THROW(ap.append(lists.size(), added.data(), 1),
+                 encoding_exception);
+    EXPECT_EQ(lists.size(), ap.add(E_AFOR, 3, added.data(), added.size()));
+    EXPECT_EQ(lists.size() / 2, ap.close());
+  }
+  lists.push_back(added);
+
+  ListContainerReader base(src);
+  ListContainerReader rd(dst);
+  ASSERT_EQ(lists.size(), rd.size());
+  EXPECT_EQ(LIST_CONTAINER_ALIGN_LINE, rd.alignment());
+  EXPECT_EQ(0U, rd.verifyAll());
+
+  for (uint64_t i = 0; i < rd.size(); i++) {
+    ListEntry e = rd.entry(i);
+    ASSERT_EQ(lists[i].size(), e.num);
+
+    /* Untouched lists stay where they are */
+    if (i < base.size() && i % 2 != 0) {
+      ListEntry o = base.entry(i);
+      EXPECT_EQ(o.offset, e.offset);
+      EXPECT_EQ(o.crc, e.crc);
+      EXPECT_EQ(0, memcmp(base.payload(o), rd.payload(e), o.len * 4));
+    }
+
+    std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(e.num));
+    rd.decode(i, dec.data(), true);
+    EXPECT_TRUE(std::equal(lists[i].begin(), lists[i].end(),
+                           dec.begin()));
+  }
+
+  remove(src);
+  remove(dst);
+}
+
+TEST(IntegerEncodingInternals, ListContainerMergerTests) {
+  const char *srcs[] = {
+    "./.listcontainer_utest.tmp",
+    "./.listcontainer_utest2.tmp",
+    "./.listcontainer_utest3.tmp"
+  };
+  const char *dst = "./.listcontainer_utest4.tmp";
+  const int policies[] = {E_P4D, E_VSEBLOCKS, E_KAFOR, E_VARIABLEBYTE};
+
+  /*
+   * Docids of terms: ones in disjoint ranges of segments, ones
+   * interleaved, ones with duplicates, and ones only in the first
+   * segment, which has more lists than the others.
+   */
+  const uint64_t nterms = 40;
+  std::vector<std::vector<uint32_t> > docs[ARRAYSIZE(srcs)];
+  std::vector<std::vector<uint32_t> > merged(nterms);
+
+  for (uint64_t t = 0; t < nterms; t++) {
+    uint32_t d = xor128() % 1000;
+    for (uint64_t s = 0; s < ARRAYSIZE(srcs); s++) {
+      if (t >= 30 && s != 0)
+        continue;
+      docs[s].resize(t + 1);
+
+      uint64_t n = xor128() % 700 + 1;
+      for (uint64_t j = 0; j < n; j++) {
+        d += xor128() % 64 + 1;
+        docs[s][t].push_back(d);
+      }
+    }
+
+    if (t % 3 == 1 && t < 30) {
+      /* Interleave segments by swapping docids of their heads */
+      std::swap(docs[0][t].back(), docs[1][t].front());
+      std::sort(docs[0][t].begin(), docs[0][t].end());
+      std::sort(docs[1][t].begin(), docs[1][t].end());
+    } else if (t % 3 == 2 && t < 30) {
+      docs[2][t].insert(docs[2][t].begin(), docs[1][t].front());
+    }
+
+    for (uint64_t s = 0; s < ARRAYSIZE(srcs); s++) {
+      if (t < docs[s].size())
+        merged[t].insert(merged[t].end(), docs[s][t].begin(),
+                         docs[s][t].end());
+    }
+    std::sort(merged[t].begin(), merged[t].end());
+    merged[t].erase(std::unique(merged[t].begin(), merged[t].end()),
+                    merged[t].end());
+  }
+
+  for (uint64_t s = 0; s < ARRAYSIZE(srcs); s++) {
+    ListContainerWriter w(srcs[s]);
+    for (uint64_t t = 0; t < docs[s].size(); t++) {
+      int id = policies[(t + s) % ARRAYSIZE(policies)];
+      EncodingPtr c = EncodingFactory::create(id);
+
+      std::vector<uint32_t> gaps;
+      for (uint64_t j = 1; j < docs[s][t].size(); j++)
+        gaps.push_back(docs[s][t][j] - docs[s][t][j - 1] - 1);
+
+      uint64_t nvalue = 0;
+      std::vector<uint32_t> out(std::max(c->require(gaps.size()),
+                                         4 * gaps.size()) + 128);
+      if (!gaps.empty()) {
+        nvalue = out.size();
+        c->encodeArray(gaps.data(), gaps.size(), out.data(), &nvalue);
+      }
+      w.append(id, gaps.size(), docs[s][t][0], out.data(), nvalue);
+    }
+    w.close();
+  }
+
+  std::vector<std::string> inputs(srcs, srcs + ARRAYSIZE(srcs));
+  EXPECT_THROW(ListContainerMerger(std::vector<std::string>()),
+               encoding_exception);
+
+  /* Batches of a few lists in threads, and one codec for all */
+  ListMergeConfig conf;
+  conf.codec = -2;
+  EXPECT_THROW(ListContainerMerger(inputs, conf), encoding_exception);
+  conf.codec = -1;
+  conf.budget = 1000;
+  conf.nthreads = 3;
+  conf.verify = true;
+
+  for (int k = 0; k < 2; k++) {
+    if (k == 1)
+      conf.codec = E_P4D;
+
+    ListMergeStats stats;
+    ListContainerMerger mg(inputs, conf);
+    ASSERT_EQ(nterms, mg.size());
+    mg.merge(dst, &stats);
+
+    EXPECT_EQ(nterms, stats.copied + stats.spliced + stats.merged);
+    if (k == 0) {
+      EXPECT_EQ(10U, stats.copied);
+      EXPECT_EQ(10U, stats.spliced);
+      EXPECT_EQ(20U, stats.merged);
+    } else {
+      EXPECT_LT(0U, stats.spliced);
+    }
+
+    ListContainerReader rd(dst);
+    ASSERT_EQ(nterms, rd.size());
+    EXPECT_EQ(0U, rd.verifyAll());
+
+    uint64_t nums = 0;
+    for (uint64_t t = 0; t < nterms; t++) {
+      ListEntry e = rd.entry(t);
+      ASSERT_EQ(merged[t].size(), e.num + 1);
+      EXPECT_EQ(merged[t][0], e.base);
+      if (k == 1)
+        EXPECT_EQ(E_P4D, e.codec);
+      nums += e.num + 1;
+
+      std::vector<uint32_t> dec(DECODE_REQUIRE_MEM(e.num));
+      rd.decode(t, dec.data());
+      GetSimdKernels().dgap(dec.data(), e.num, e.base);
+      EXPECT_TRUE(std::equal(merged[t].begin() + 1, merged[t].end(),
+                             dec.begin()));
+    }
+    EXPECT_EQ(nums, stats.nums);
+  }
+
+  for (uint64_t s = 0; s < ARRAYSIZE(srcs); s++)
+    remove(srcs[s]);
+  remove(dst);
+}
+
 namespace {
 
 class SkewedRandom {
@@ -291,7 +1632,8 @@ INSTANTIATE_TEST_CASE_P(
                     E_VARIABLEBYTE, E_BINARYIPL,
                     E_SIMPLE9, E_SIMPLE16,
                     E_P4D, E_OPTP4D,
-                    E_VSEBLOCKS, E_VSER, E_VSEREST, E_VSEHYB, E_VSESIMPLE));
+                    E_VSEBLOCKS, E_VSER, E_VSEREST, E_VSEHYB, E_VSESIMPLE,
+                    E_ADAPTIVE));
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
@@ -137,6 +137,11 @@ EncodingPtr EncodingFactory::create(const int policy) {
 				static_cast<internals::EncodingBase*>(new internals::AFOR()));
 		break;
 	}
+	case E_ADAPTIVE: {
+		return EncodingPtr(
+				static_cast<internals::EncodingBase*>(new internals::AdaptiveBlocks()));
+		break;
+	}
 	}
 
 	THROW_ENCODING_EXCEPTION("Invalid value: policy");
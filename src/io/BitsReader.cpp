@@ -21,14 +21,23 @@ namespace internals {
 
 namespace {
 
-#define BITSRD_BUFFILL(__cond__)  \
-    ASSERT(__cond__ <= 32);       \
-    ASSERT(in_ != NULL);          \
-    if (fill_ < __cond__) {       \
-      buffer_ = (buffer_ << 32) | BYTEORDER_FREE_LOAD32(in_);     \
-      in_++, fill_ += 32;         \
-      if (UNLIKELY(in_ > term_))  \
-        THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");  \
+/*
+ * Decode codes with a multi-symbol table while a whole entry
+ * can be written in [out] and the reader is unchecked, and a
+ * code longer than 16 bits is decoded by [__single__]. The
+ * caller decodes the tail.
+ */
+#define BITSRD_MULTIDEC(__table__, __max__, __single__)         \
+    for (; i + __max__ <= nvalues && unchecked();) {              \
+      decltype(*__table__) e = __table__[peek(16)];               \
+      if (UNLIKELY(e.num == 0)) {                                 \
+        out[i++] = __single__();                                  \
+        continue;                                                 \
+      }                                                           \
+      consume(e.bits);                                            \
+      for (uint32_t j = 0; j < __max__; j++)                      \
+        out[i + j] = e.vals[j];                                   \
+      i += e.num;                                                 \
     }
 
 const uint32_t F_MASK32 = 0xffff;
@@ -38,7 +47,9 @@ const uint32_t F_MASK32 = 0xffff;
 /* namespace: */
 
 BitsReader::BitsReader(const uint32_t *in, uint64_t len) :
-		in_(in), term_(in + len), buffer_(0), fill_(0) {
+		in_(in), term_(in + len),
+		fast_((len >= BITSRD_SLACK) ? in + len - BITSRD_SLACK + 1 : in),
+		off_(0) {
 	if (in == NULL)
 		THROW_ENCODING_EXCEPTION("Invalid value: in");
 	if (len == 0)
@@ -51,17 +62,51 @@ BitsReader::~BitsReader() throw () {
 }
 
 uint32_t BitsReader::read_bits(uint32_t num) {
+	if (LIKELY(unchecked()))
+		return fetch(num);
+
 	if (UNLIKELY(num == 0))
 		return 0;
 	ASSERT(num <= 32);
-	BITSRD_BUFFILL(num);
-	fill_ -= num;
-	return (buffer_ >> fill_) & ((uint64_t(1) << num) - 1);
+	if (UNLIKELY(left() < num))
+		THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+
+	uint32_t val = peek_tail(num);
+	consume(num);
+	return val;
 }
 
 const uint32_t *BitsReader::pos() const {
 	ASSERT(in_ != NULL);
-	return in_ - 1;
+	return (off_ == 0) ? in_ - 1 : in_;
+}
+
+uint64_t BitsReader::left() const {
+	return uint64_t(term_ - in_) * 32 - off_;
+}
+
+/* The same as peek() but not to load a word beyond [term_] */
+uint32_t BitsReader::peek_tail(uint32_t num) const {
+	ASSERT(num <= 32 && left() >= num);
+	if (LIKELY(in_ + 1 < term_))
+		return peek(num);
+	uint64_t w = (uint64_t(BYTEORDER_FREE_LOAD32(in_)) << 32) << off_;
+	return (w >> 32) >> (32 - num);
+}
+
+uint32_t BitsReader::fetch_ngamma() {
+	uint32_t w = peek(32);
+	if (UNLIKELY(w == 0))
+		THROW_ENCODING_EXCEPTION("Invalid code: gamma");
+	uint32_t count = MSB32(w);
+	consume(count);
+	return fetch(count + 1) - 1;
+}
+
+uint32_t BitsReader::fetch_ndelta() {
+	uint32_t count = fetch_ngamma();
+	ASSERT(count < 32);
+	return ((1U << count) | fetch(count)) - 1;
 }
 
 uint32_t BitsReader::read_unary() {
@@ -72,19 +117,17 @@ uint32_t BitsReader::read_unary() {
 }
 // 利用表查找来快速读取1元编码的值，这里采用的是16bit为单位查找
 uint32_t BitsReader::read_funary() {
-	if (LIKELY(in_ != term_)) {
-		BITSRD_BUFFILL(16);
-		uint32_t idx = (buffer_ >> (fill_ - 16)) & F_MASK32;
-		uint32_t dec = decUnary[idx];
+	if (LIKELY(left() >= 16)) {
+		uint32_t dec = decUnary[peek_tail(16)];
 
 		ASSERT(dec <= 16);
 
 		if (UNLIKELY(dec == 16)) {
-			fill_ -= 16;
+			consume(16);
 			return read_funary() + dec;
 		}
 
-		fill_ -= dec + 1;
+		consume(dec + 1);
 		return dec;
 	}
 
@@ -92,21 +135,22 @@ uint32_t BitsReader::read_funary() {
 }
 // 无任何表查找
 uint32_t BitsReader::read_ngamma() {
+	if (LIKELY(unchecked()))
+		return fetch_ngamma();
+
 	uint32_t count = read_unary();
 	ASSERT(count < 32);
 	return ((1U << count) | read_bits(count)) - 1;
 }
 // 表查找16bit所能存储的gamma编码值
 uint32_t BitsReader::read_fgamma() {
-	if (LIKELY(in_ != term_)) {
-		BITSRD_BUFFILL(16);
-		uint32_t idx = (buffer_ >> (fill_ - 16)) & F_MASK32;
-		uint32_t dec = decGamma[idx];
+	if (LIKELY(left() >= 16)) {
+		uint32_t dec = decGamma[peek_tail(16)];
 
 		if (UNLIKELY(dec == 0))
 			return read_ngamma();
 
-		fill_ -= (dec >> 16);
+		consume(dec >> 16);
 		return (dec & F_MASK32) - 1;
 	}
 
@@ -143,7 +187,12 @@ void BitsReader::fgammaArray(uint32_t *out, uint64_t nvalues) {
 
 	ASSERT_ADDR(out, nvalues);
 
-	for (uint64_t i = 0; i < nvalues && in_ <= term_; i++)
+	const MultiGammaEntry *table = decMultiGamma();
+
+	uint64_t i = 0;
+	BITSRD_MULTIDEC(table, MULTI_GAMMA_MAX, fetch_ngamma);
+
+	for (; i < nvalues && in_ <= term_; i++)
 		out[i] = read_fgamma();
 }
 
@@ -162,21 +211,22 @@ void BitsReader::fugammaArray(uint32_t *out, uint64_t nvalues) {
 }
 // 无任何表查找
 uint32_t BitsReader::read_ndelta() {
+	if (LIKELY(unchecked()))
+		return fetch_ndelta();
+
 	uint32_t count = read_ngamma();
 	ASSERT(count < 32);
 	return ((1U << count) | read_bits(count)) - 1;
 }
 // 表查找16bit所能存储的delta编码值
 uint32_t BitsReader::read_fdelta() {
-	if (LIKELY(in_ != term_)) {
-		BITSRD_BUFFILL(16);
-		uint32_t idx = (buffer_ >> (fill_ - 16)) & F_MASK32;
-		uint32_t dec = decDelta[idx];
+	if (LIKELY(left() >= 16)) {
+		uint32_t dec = decDelta[peek_tail(16)];
 
 		if (UNLIKELY(dec == 0))
 			return read_ndelta();
 
-		fill_ -= (dec >> 16);
+		consume(dec >> 16);
 		return (dec & ((uint64_t(1) << 16) - 1)) - 1;
 	}
 
@@ -235,12 +285,14 @@ void BitsReader::fgdeltaArray(uint32_t *out, uint64_t nvalues) {
 
 	ASSERT_ADDR(out, nvalues);
 
-	for (uint64_t i = 0; i < nvalues && in_ <= term_; i++) {
-//		uint32_t count = read_fgamma();
-//		ASSERT(count < 32);
-//		out[i] = ((1U << count) | read_bits(count)) - 1;
+	/* FG Delta shares the bit stream with F Delta */
+	const MultiDeltaEntry *table = decMultiDelta();
+
+	uint64_t i = 0;
+	BITSRD_MULTIDEC(table, MULTI_DELTA_MAX, fetch_ndelta);
+
+	for (; i < nvalues && in_ <= term_; i++)
 		out[i] = read_fgdelta();
-	}
 }
 
 void BitsReader::fdeltaArray(uint32_t *out, uint64_t nvalues) {
@@ -253,7 +305,12 @@ void BitsReader::fdeltaArray(uint32_t *out, uint64_t nvalues) {
 
 	ASSERT_ADDR(out, nvalues);
 
-	for (uint64_t i = 0; i < nvalues && in_ <= term_; i++)
+	const MultiDeltaEntry *table = decMultiDelta();
+
+	uint64_t i = 0;
+	BITSRD_MULTIDEC(table, MULTI_DELTA_MAX, fetch_ndelta);
+
+	for (; i < nvalues && in_ <= term_; i++)
 		out[i] = read_fdelta();
 }
 
@@ -36,32 +36,77 @@ BitsWriter::BitsWriter(uint32_t *out,
 
 BitsWriter::~BitsWriter() throw() {}
 
+/*
+ * Append [num] bits (num <= 32) to the 64-bit accumulator, and
+ * store a word if it fills. [val] must fit in [num] bits, and
+ * a caller checks the space in advance.
+ */
+inline void BitsWriter::put_bits(uint32_t val,
+                                 uint32_t num) {
+  ASSERT(num <= 32 && fill_ < 32);
+  buffer_ = (buffer_ << num) | val;
+  fill_ += num;
+
+  if (fill_ >= 32) {
+    fill_ -= 32;
+    BYTEORDER_FREE_STORE32(out_,
+        static_cast<uint32_t>(buffer_ >> fill_));
+    out_++, nwritten_++;
+  }
+}
+
+/* Throw an exception if [num] bits more overrun the output */
+inline void BitsWriter::reserve_bits(uint64_t num) const {
+  ASSERT(out_ != NULL);
+  if (UNLIKELY(uint64_t(term_ - out_) * 32 < fill_ + num))
+    THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
+}
+
 void BitsWriter::write_bits(uint32_t val,
                             uint32_t num) {
   if (num > 32)
     THROW_ENCODING_EXCEPTION("Out of range exception: num");
 
-  ASSERT(out_ != NULL);
-
   if (LIKELY(num > 0)) {
-    if (out_ >= term_)
-      THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
-
-    buffer_ = (buffer_ << num) |
-        (val & ((uint64_t(1) << num) - 1));
-    fill_ += num;
-
-    if (fill_ >= 32) {
-      BYTEORDER_FREE_STORE32(
-          out_, (buffer_ >> (fill_ - 32)) &
-                    ((uint64_t(1) << 32) - 1));
-      out_++, nwritten_++, fill_ -= 32;
-      if (out_ >= term_&& fill_ > 0)
-        THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
-    }
+    reserve_bits(num);
+    put_bits(val & ((uint64_t(1) << num) - 1), num);
   }
 }
 
+void BitsWriter::write_code(uint64_t code,
+                            uint32_t num) {
+  ASSERT(num <= 64);
+  reserve_bits(num);
+
+  if (num > 32) {
+    put_bits(code >> 32, num - 32);
+    put_bits(static_cast<uint32_t>(code), 32);
+  } else {
+    put_bits(code, num);
+  }
+}
+
+void BitsWriter::write_fixed_array(const uint32_t *in,
+                                   uint64_t n,
+                                   uint32_t b) {
+  if (in == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid value: in");
+  if (b > 32)
+    THROW_ENCODING_EXCEPTION("Out of range exception: b");
+
+  if (UNLIKELY(n == 0 || b == 0))
+    return;
+
+  ASSERT_ADDR(in, n);
+
+  /* Check the space once, and no check is needed in the loop */
+  reserve_bits(n * b);
+
+  uint32_t mask = (uint64_t(1) << b) - 1;
+  for (uint64_t i = 0; i < n; i++)
+    put_bits(in[i] & mask, b);
+}
+
 void BitsWriter::flush_bits() {
   if (out_ >= term_ && fill_ > 0)
     THROW_ENCODING_EXCEPTION("Buffer-overflowed exception");
@@ -87,17 +132,14 @@ uint64_t BitsWriter::size() const {
   return nwritten_;
 }
 
-void BitsWriter::write_unary(uint32_t val) {
-  ASSERT(val < 32);
-  write_bits(0, val);
-  write_bits(1, 1);
-}
-
+/*
+ * A gamma code of (val + 1) is d zeros followed by (val + 1)
+ * itself in (d + 1) bits, so it is (val + 1) in (2d + 1) bits.
+ */
 void BitsWriter::write_gamma(uint32_t val) {
   uint32_t d = 31 - MSB32(val + 1);
   ASSERT(d < 32);
-  write_unary(d);
-  write_bits(val + 1, d);
+  write_code(val + 1, 2 * d + 1);
 }
 
 uint32_t BitsWriter::gammaArray(const uint32_t *in,
@@ -126,12 +168,15 @@ uint32_t BitsWriter::deltaArray(const uint32_t *in,
 
   ASSERT_ADDR(in, len);
 
+  /* A gamma code of (d + 1) and low d bits in a single write */
   for (uint64_t i = 0;
            i < len && out_ < term_; i++) {
     uint32_t d = 31 - MSB32(in[i] + 1);
     ASSERT(d < 32);
-    write_gamma(d);
-    write_bits(in[i] + 1, d);
+    uint32_t g = 31 - MSB32(d + 1);
+    uint64_t code = (uint64_t(d + 1) << d) |
+        ((in[i] + 1) & ((uint64_t(1) << d) - 1));
+    write_code(code, 2 * g + 1 + d);
   }
 
   flush_bits();
@@ -0,0 +1,377 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_aio.cpp - Batched reads of a file with io_uring
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_aio.hpp>
+
+#include <omp.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+
+#if defined(__linux__)
+# include <sys/syscall.h>
+# include <linux/io_uring.h>
+# if defined(__NR_io_uring_setup) && defined(__NR_io_uring_register) && \
+    defined(IORING_OFF_SQES)
+#  define AIO_ENABLE_URING
+# endif
+#endif
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+/* Reads longer than this complete in pieces */
+const uint64_t AIO_MAX_READ = 1ULL << 30;
+
+/* Read all [len] bytes, or return false on errors and EOF */
+bool PreadFully(int fd, void *buf, uint64_t len, uint64_t off) {
+  char *p = reinterpret_cast<char *>(buf);
+
+  while (len > 0) {
+    ssize_t r = pread(fd, p, (len < AIO_MAX_READ)? len : AIO_MAX_READ, off);
+    if (r < 0 && errno == EINTR)
+      continue;
+    if (r <= 0)
+      return false;
+
+    p += r, off += r, len -= r;
+  }
+
+  return true;
+}
+
+bool IsRingDisabled() {
+  const char *mode = getenv(AIO_MODE_ENV);
+  return mode != NULL && strcmp(mode, "pread") == 0;
+}
+
+} /* namespace: */
+
+#ifdef AIO_ENABLE_URING
+
+/*
+ * Rings shared with the kernel. No SQPOLL is used, so the kernel
+ * consumes submissions only in io_uring_enter().
+ */
+struct AioRing {
+  int           fd;
+  uint32_t      entries;
+
+  void          *sq;
+  size_t        sqsz;
+  void          *cq;
+  size_t        cqsz;
+  io_uring_sqe  *sqes;
+  size_t        sqesz;
+
+  unsigned      *sqhead;
+  unsigned      *sqtail;
+  unsigned      sqmask;
+  unsigned      *sqarray;
+  unsigned      *cqhead;
+  unsigned      *cqtail;
+  unsigned      cqmask;
+  io_uring_cqe  *cqes;
+};
+
+namespace {
+
+void DestroyRing(AioRing *r) {
+  if (r->sqes != MAP_FAILED)
+    munmap(r->sqes, r->sqesz);
+  if (r->cq != MAP_FAILED && r->cq != r->sq)
+    munmap(r->cq, r->cqsz);
+  if (r->sq != MAP_FAILED)
+    munmap(r->sq, r->sqsz);
+  close(r->fd);
+  delete r;
+}
+
+/*
+ * Whether a ring takes IORING_OP_READ. Kernels from 5.1 to 5.5 make
+ * rings without it, and fail every read with -EINVAL. It comes with
+ * the probe in 5.6, so a failed probe means no support.
+ */
+bool ProbeRead(int fd) {
+  const uint32_t nops = 256;
+  std::vector<char> buf(sizeof(io_uring_probe) +
+                        nops * sizeof(io_uring_probe_op), 0);
+  io_uring_probe *probe = reinterpret_cast<io_uring_probe *>(buf.data());
+
+  if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE,
+              probe, nops) < 0)
+    return false;
+
+  return IORING_OP_READ < probe->ops_len &&
+      (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+/* Return NULL if the kernel has no io_uring for reads or denies it */
+AioRing *CreateRing(uint32_t depth) {
+  io_uring_params p;
+  memset(&p, 0x00, sizeof(p));
+
+  int fd = syscall(__NR_io_uring_setup, depth, &p);
+  if (fd < 0)
+    return NULL;
+
+  if (!ProbeRead(fd)) {
+    close(fd);
+    return NULL;
+  }
+
+  AioRing *r = new AioRing;
+  r->fd = fd;
+  r->entries = p.sq_entries;
+  r->sq = r->cq = MAP_FAILED;
+  r->sqes = reinterpret_cast<io_uring_sqe *>(MAP_FAILED);
+  r->sqsz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  r->cqsz = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+  r->sqesz = p.sq_entries * sizeof(io_uring_sqe);
+
+  /* Newer kernels map both rings at once */
+  bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single)
+    r->sqsz = r->cqsz = (r->sqsz < r->cqsz)? r->cqsz : r->sqsz;
+
+  r->sq = mmap(NULL, r->sqsz, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (r->sq == MAP_FAILED) {
+    DestroyRing(r);
+    return NULL;
+  }
+
+  r->cq = (single)? r->sq :
+      mmap(NULL, r->cqsz, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+  r->sqes = reinterpret_cast<io_uring_sqe *>(
+      mmap(NULL, r->sqesz, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+  if (r->cq == MAP_FAILED || r->sqes == MAP_FAILED) {
+    DestroyRing(r);
+    return NULL;
+  }
+
+  char *sq = reinterpret_cast<char *>(r->sq);
+  char *cq = reinterpret_cast<char *>(r->cq);
+
+  r->sqhead = reinterpret_cast<unsigned *>(sq + p.sq_off.head);
+  r->sqtail = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+  r->sqmask = *reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+  r->sqarray = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+  r->cqhead = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+  r->cqtail = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+  r->cqmask = *reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+  r->cqes = reinterpret_cast<io_uring_cqe *>(cq + p.cq_off.cqes);
+
+  return r;
+}
+
+} /* namespace: */
+
+#else
+
+struct AioRing {};
+
+namespace {
+
+void DestroyRing(AioRing *r) {
+  delete r;
+}
+
+AioRing *CreateRing(uint32_t depth) {
+  return NULL;
+}
+
+} /* namespace: */
+
+#endif /* AIO_ENABLE_URING */
+
+AioReader::AioReader(int fd, uint32_t depth, int nthreads)
+    : fd_(fd), depth_(depth), nthreads_(nthreads), ring_(NULL) {
+  if (fd < 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: fd");
+  if (depth == 0)
+    THROW_ENCODING_EXCEPTION("Invalid value: depth");
+
+  if (nthreads_ <= 0)
+    nthreads_ = omp_get_max_threads();
+
+  if (!IsRingDisabled())
+    ring_ = CreateRing(depth);
+}
+
+AioReader::~AioReader() throw() {
+  if (ring_ != NULL)
+    DestroyRing(ring_);
+}
+
+void AioReader::read(const AioRequest *reqs, uint64_t n,
+                     const done_t& done) {
+  if (reqs == NULL && n != 0)
+    THROW_ENCODING_EXCEPTION("Invalid input: reqs");
+
+  if (ring_ != NULL)
+    readRing(reqs, n, done);
+  else
+    readThreads(reqs, n, done);
+}
+
+#ifdef AIO_ENABLE_URING
+
+void AioReader::readRing(const AioRequest *reqs, uint64_t n,
+                         const done_t& done) {
+  AioRing *r = ring_;
+
+  uint64_t next = 0;
+  uint64_t inflight = 0;
+  bool failed = false;
+  std::exception_ptr err;
+
+  while (next < n || inflight > 0) {
+    /* Queue reads up to the ring size, which bounds the CQ too */
+    unsigned tail = *r->sqtail;
+    while (!failed && next < n && inflight < r->entries) {
+      unsigned idx = tail & r->sqmask;
+      io_uring_sqe *sqe = r->sqes + idx;
+      uint64_t len = reqs[next].len;
+
+      memset(sqe, 0x00, sizeof(*sqe));
+      sqe->opcode = IORING_OP_READ;
+      sqe->fd = fd_;
+      sqe->off = reqs[next].off;
+      sqe->addr = reinterpret_cast<uint64_t>(reqs[next].buf);
+      sqe->len = (len < AIO_MAX_READ)? len : AIO_MAX_READ;
+      sqe->user_data = next;
+
+      r->sqarray[idx] = idx;
+      tail++, next++, inflight++;
+    }
+    __atomic_store_n(r->sqtail, tail, __ATOMIC_RELEASE);
+
+    if (inflight == 0)
+      break;
+
+    /* Submit what the kernel has not consumed, and wait for one */
+    unsigned nsubmit = tail - __atomic_load_n(r->sqhead, __ATOMIC_ACQUIRE);
+    if (syscall(__NR_io_uring_enter, r->fd, nsubmit, 1,
+                IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+        errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+      /*
+       * It fails only on bad arguments, e.g., a broken ring. Reads
+       * not consumed yet are dropped, but ones in flight still write
+       * into buffers of a caller, so they are waited for before the
+       * exception is thrown.
+       */
+      unsigned head = __atomic_load_n(r->sqhead, __ATOMIC_ACQUIRE);
+      inflight -= tail - head;
+      __atomic_store_n(r->sqtail, head, __ATOMIC_RELEASE);
+
+      if (!failed) {
+        failed = true;
+        try {
+          THROW_ENCODING_EXCEPTION("I/O exception: can't read a file");
+        } catch (...) {
+          err = std::current_exception();
+        }
+      }
+
+      /* Let the kernel run completions without entering the ring */
+      sched_yield();
+    }
+
+    unsigned head = *r->cqhead;
+    unsigned ctail = __atomic_load_n(r->cqtail, __ATOMIC_ACQUIRE);
+
+    for (; head != ctail; head++) {
+      const io_uring_cqe *cqe = r->cqes + (head & r->cqmask);
+      uint64_t i = cqe->user_data;
+      int32_t res = cqe->res;
+
+      inflight--;
+      if (failed)
+        continue;
+
+      try {
+        /*
+         * Short reads, e.g., of huge lists, end synchronously, and
+         * failed ones are read again in whole.
+         */
+        if (res < 0)
+          res = 0;
+        if (!PreadFully(fd_, reinterpret_cast<char *>(reqs[i].buf) + res,
+                        reqs[i].len - res, reqs[i].off + res))
+          THROW_ENCODING_EXCEPTION("I/O exception: can't read a file");
+        done(i);
+      } catch (...) {
+        failed = true;
+        err = std::current_exception();
+      }
+    }
+
+    __atomic_store_n(r->cqhead, head, __ATOMIC_RELEASE);
+  }
+
+  if (failed)
+    std::rethrow_exception(err);
+}
+
+#else
+
+void AioReader::readRing(const AioRequest *reqs, uint64_t n,
+                         const done_t& done) {
+  readThreads(reqs, n, done);
+}
+
+#endif /* AIO_ENABLE_URING */
+
+void AioReader::readThreads(const AioRequest *reqs, uint64_t n,
+                            const done_t& done) {
+  bool failed = false;
+  std::exception_ptr err;
+  int64_t num = n;
+
+#pragma omp parallel for num_threads(nthreads_) schedule(dynamic, 1)
+  for (int64_t i = 0; i < num; i++) {
+    bool skip;
+#pragma omp atomic read
+    skip = failed;
+    if (skip)
+      continue;
+
+    try {
+      if (!PreadFully(fd_, reqs[i].buf, reqs[i].len, reqs[i].off))
+        THROW_ENCODING_EXCEPTION("I/O exception: can't read a file");
+      done(i);
+    } catch (...) {
+#pragma omp critical(aio_reader)
+      {
+        if (!failed)
+          err = std::current_exception();
+#pragma omp atomic write
+        failed = true;
+      }
+    }
+  }
+
+  if (failed)
+    std::rethrow_exception(err);
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
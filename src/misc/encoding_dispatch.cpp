@@ -0,0 +1,464 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_dispatch.cpp - Run-time selection of SIMD kernels
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_internals.hpp>
+#include <misc/encoding_dispatch.hpp>
+
+#if defined(__x86_64__) || defined(__x86_64)
+# define SIMD_ENABLE_X86
+# include <cpuid.h>
+# include <immintrin.h>
+#endif
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+const char *SIMD_LEVEL_NAMES[] = {
+  "scalar", "sse2", "sse4.1", "avx2", "avx512"
+};
+
+/* Scalar kernels, used on non-x86 platforms */
+void CopyScalar(uint32_t *dest, const uint32_t *src, uint64_t n) {
+  memcpy(dest, src, ((n + 3) >> 2) << 4);
+}
+
+void ZeroScalar(uint32_t *dest, uint64_t n) {
+  memset(dest, 0x00, ((n + 3) >> 2) << 4);
+}
+
+uint32_t DgapScalar(uint32_t *list, uint64_t n, uint32_t prev) {
+  for (uint64_t i = 0; i < n; i++)
+    list[i] = (prev += list[i] + 1);
+  return prev;
+}
+
+/* A reflected polynomial of CRC-32C */
+const uint32_t CRC32C_POLY = 0x82f63b78;
+
+/* Bytes of each stream that the SSE4.2 kernel interleaves */
+const uint64_t CRC32C_STREAM = 1024;
+
+/*
+ * A product of [a] and [b] modulo CRC32C_POLY. Polynomials are
+ * reflected, so the MSB is the coefficient of x^0.
+ */
+uint32_t Crc32cMultiply(uint32_t a, uint32_t b) {
+  uint32_t p = 0;
+  for (uint32_t m = 1U << 31; m != 0; m >>= 1) {
+    if (a & m)
+      p ^= b;
+    b = (b & 1)? (b >> 1) ^ CRC32C_POLY : b >> 1;
+  }
+  return p;
+}
+
+/* x^(8n) modulo CRC32C_POLY */
+uint32_t Crc32cBytePower(uint64_t n) {
+  uint32_t p = 1U << 31;
+  uint32_t x = 1U << 23;    /* x^8 */
+  for (; n != 0; n >>= 1, x = Crc32cMultiply(x, x)) {
+    if (n & 1)
+      p = Crc32cMultiply(x, p);
+  }
+  return p;
+}
+
+/*
+ * Tables of a byte-wise kernel and of products to shift a crc
+ * over 1 or 2 streams of zeros, which are linear in each byte.
+ */
+struct Crc32cTables {
+  uint32_t  bytes[256];
+  uint32_t  shift1[4][256];
+  uint32_t  shift2[4][256];
+
+  Crc32cTables() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++)
+        c = (c & 1)? (c >> 1) ^ CRC32C_POLY : c >> 1;
+      bytes[i] = c;
+    }
+
+    uint32_t k1 = Crc32cBytePower(CRC32C_STREAM);
+    uint32_t k2 = Crc32cBytePower(2 * CRC32C_STREAM);
+    for (uint32_t j = 0; j < 4; j++) {
+      for (uint32_t i = 0; i < 256; i++) {
+        shift1[j][i] = Crc32cMultiply(k1, i << (8 * j));
+        shift2[j][i] = Crc32cMultiply(k2, i << (8 * j));
+      }
+    }
+  }
+};
+
+const Crc32cTables& GetCrc32cTables() {
+  static const Crc32cTables tables;
+  return tables;
+}
+
+inline uint32_t Crc32cShift(const uint32_t (*t)[256], uint32_t c) {
+  return t[0][c & 0xff] ^ t[1][(c >> 8) & 0xff] ^
+      t[2][(c >> 16) & 0xff] ^ t[3][c >> 24];
+}
+
+uint32_t Crc32cScalar(uint32_t crc, const void *buf, uint64_t n) {
+  const uint32_t *t = GetCrc32cTables().bytes;
+  const uint8_t *p = static_cast<const uint8_t *>(buf);
+
+  crc = ~crc;
+  for (uint64_t i = 0; i < n; i++)
+    crc = t[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+  return ~crc;
+}
+
+#ifdef SIMD_ENABLE_X86
+
+#define SIMD_TARGET(__x__)  __attribute__((target(__x__)))
+
+/*
+ * crc32 has the latency of 3 cycles and the throughput of 1, so
+ * three streams are updated at once and merged by shifting.
+ */
+SIMD_TARGET("sse4.2")
+uint32_t Crc32cSSE42(uint32_t crc, const void *buf, uint64_t n) {
+  const uint8_t *p = static_cast<const uint8_t *>(buf);
+  uint64_t c0 = ~crc;
+
+  for (; n > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0; n--)
+    c0 = _mm_crc32_u8(c0, *p++);
+
+  if (n >= 3 * CRC32C_STREAM) {
+    const Crc32cTables& t = GetCrc32cTables();
+
+    for (; n >= 3 * CRC32C_STREAM; n -= 3 * CRC32C_STREAM) {
+      uint64_t c1 = 0;
+      uint64_t c2 = 0;
+
+      for (uint64_t i = 0; i < CRC32C_STREAM; i += 8, p += 8) {
+        c0 = _mm_crc32_u64(c0, LOAD64(p));
+        c1 = _mm_crc32_u64(c1, LOAD64(p + CRC32C_STREAM));
+        c2 = _mm_crc32_u64(c2, LOAD64(p + 2 * CRC32C_STREAM));
+      }
+
+      c0 = Crc32cShift(t.shift2, c0) ^ Crc32cShift(t.shift1, c1) ^ c2;
+      p += 2 * CRC32C_STREAM;
+    }
+  }
+
+  for (; n >= 8; n -= 8, p += 8)
+    c0 = _mm_crc32_u64(c0, LOAD64(p));
+  for (; n > 0; n--)
+    c0 = _mm_crc32_u8(c0, *p++);
+
+  return ~static_cast<uint32_t>(c0);
+}
+
+void CopySSE2(uint32_t *dest, const uint32_t *src, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (uint64_t i = 0; i < num; i++, src += 4, dest += 4)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+}
+
+void ZeroSSE2(uint32_t *dest, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (uint64_t i = 0; i < num; i++, dest += 4)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_setzero_si128());
+}
+
+uint32_t DgapSSE2(uint32_t *list, uint64_t n, uint32_t prev) {
+  const __m128i one = _mm_set1_epi32(1);
+  __m128i carry = _mm_set1_epi32(prev);
+
+  uint64_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i *p = reinterpret_cast<__m128i *>(list + i);
+    __m128i v = _mm_add_epi32(_mm_loadu_si128(p), one);
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+    v = _mm_add_epi32(v, carry);
+    _mm_storeu_si128(p, v);
+    carry = _mm_shuffle_epi32(v, 0xff);
+  }
+
+  return DgapScalar(list + i, n - i,
+                    static_cast<uint32_t>(_mm_cvtsi128_si32(carry)));
+}
+
+SIMD_TARGET("avx2")
+void CopyAVX2(uint32_t *dest, const uint32_t *src, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (; num >= 2; num -= 2, src += 8, dest += 8)
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)));
+  if (num > 0)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+}
+
+SIMD_TARGET("avx2")
+void ZeroAVX2(uint32_t *dest, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (; num >= 2; num -= 2, dest += 8)
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest),
+                        _mm256_setzero_si256());
+  if (num > 0)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_setzero_si128());
+}
+
+SIMD_TARGET("avx2")
+uint32_t DgapAVX2(uint32_t *list, uint64_t n, uint32_t prev) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i lo3 = _mm256_set1_epi32(3);
+  const __m256i hi7 = _mm256_set1_epi32(7);
+  __m256i carry = _mm256_set1_epi32(prev);
+
+  uint64_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i *p = reinterpret_cast<__m256i *>(list + i);
+    __m256i v = _mm256_add_epi32(_mm256_loadu_si256(p), one);
+
+    /* Prefix sums in each 128-bit lane, and then across them */
+    v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+    v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+    v = _mm256_add_epi32(v, _mm256_blend_epi32(_mm256_setzero_si256(),
+        _mm256_permutevar8x32_epi32(v, lo3), 0xf0));
+
+    v = _mm256_add_epi32(v, carry);
+    _mm256_storeu_si256(p, v);
+    carry = _mm256_permutevar8x32_epi32(v, hi7);
+  }
+
+  return DgapSSE2(list + i, n - i,
+      static_cast<uint32_t>(_mm256_extract_epi32(carry, 0)));
+}
+
+SIMD_TARGET("avx512f")
+void CopyAVX512(uint32_t *dest, const uint32_t *src, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (; num >= 4; num -= 4, src += 16, dest += 16)
+    _mm512_storeu_si512(dest, _mm512_loadu_si512(src));
+  for (; num > 0; num--, src += 4, dest += 4)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+}
+
+SIMD_TARGET("avx512f")
+void ZeroAVX512(uint32_t *dest, uint64_t n) {
+  uint64_t num = (n + 3) >> 2;
+  for (; num >= 4; num -= 4, dest += 16)
+    _mm512_storeu_si512(dest, _mm512_setzero_si512());
+  for (; num > 0; num--, dest += 4)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest),
+                     _mm_setzero_si128());
+}
+
+SIMD_TARGET("avx512f")
+uint32_t DgapAVX512(uint32_t *list, uint64_t n, uint32_t prev) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i last = _mm512_set1_epi32(15);
+  __m512i carry = _mm512_set1_epi32(prev);
+
+  uint64_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512i v = _mm512_add_epi32(_mm512_loadu_si512(list + i), one);
+
+    /* alignr(v, 0, 16 - k) shifts [v] by k elements */
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 15));
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 14));
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 12));
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 8));
+
+    v = _mm512_add_epi32(v, carry);
+    _mm512_storeu_si512(list + i, v);
+    carry = _mm512_permutexvar_epi32(last, v);
+  }
+
+  return DgapSSE2(list + i, n - i,
+      static_cast<uint32_t>(_mm_cvtsi128_si32(
+              _mm512_castsi512_si128(carry))));
+}
+
+uint64_t ReadXCR0() {
+  uint32_t eax, edx;
+  __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+#endif /* SIMD_ENABLE_X86 */
+
+CpuFeatures ProbeCpuFeatures() {
+  CpuFeatures f;
+  memset(&f, 0x00, sizeof(f));
+
+#ifdef SIMD_ENABLE_X86
+  uint32_t eax, ebx, ecx, edx;
+  uint32_t maxleaf = __get_cpuid_max(0, NULL);
+
+  if (maxleaf < 1 || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    return f;
+
+  f.sse2 = (edx & bit_SSE2) != 0;
+  f.sse41 = (ecx & bit_SSE4_1) != 0;
+  f.sse42 = (ecx & bit_SSE4_2) != 0;
+
+  /* AVX states must be enabled by OS */
+  bool osxsave = (ecx & bit_OSXSAVE) != 0;
+  uint64_t xcr0 = (osxsave)? ReadXCR0() : 0;
+  bool ymm = (xcr0 & 0x06) == 0x06;
+  bool zmm = (xcr0 & 0xe6) == 0xe6;
+
+  if (maxleaf >= 7) {
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    f.avx2 = ymm && (ebx & (1U << 5)) != 0;
+    f.bmi2 = (ebx & (1U << 8)) != 0;
+    f.avx512f = zmm && (ebx & (1U << 16)) != 0;
+  }
+#endif /* SIMD_ENABLE_X86 */
+
+  return f;
+}
+
+int DetectSimdLevel(const CpuFeatures& f) {
+  if (f.avx512f && f.avx2 && f.bmi2)
+    return SIMD_AVX512;
+  if (f.avx2 && f.bmi2)
+    return SIMD_AVX2;
+  if (f.sse41)
+    return SIMD_SSE41;
+  if (f.sse2)
+    return SIMD_SSE2;
+  return SIMD_SCALAR;
+}
+
+int ParseSimdLevel(const char *name) {
+  if (name == NULL)
+    return -1;
+
+  for (int i = 0; i < static_cast<int>(ARRAYSIZE(SIMD_LEVEL_NAMES)); i++) {
+    if (strcmp(name, SIMD_LEVEL_NAMES[i]) == 0)
+      return i;
+  }
+
+  /* Accept an alias without a dot */
+  if (strcmp(name, "sse41") == 0)
+    return SIMD_SSE41;
+
+  return -1;
+}
+
+struct SimdState {
+  CpuFeatures features;
+  int         detected;
+  int         level;
+  SimdKernels kernels[SIMD_AVX512 + 1];
+
+  SimdState() : features(ProbeCpuFeatures()),
+      detected(DetectSimdLevel(features)), level(detected) {
+    int forced = ParseSimdLevel(getenv(SIMD_LEVEL_ENV));
+    if (forced >= 0 && forced < detected)
+      level = forced;
+
+    for (int i = 0; i <= SIMD_AVX512; i++) {
+      SimdKernels& k = kernels[i];
+      k.level = i;
+      k.copy = CopyScalar;
+      k.zero = ZeroScalar;
+      k.dgap = DgapScalar;
+      k.crc32c = Crc32cScalar;
+
+#ifdef SIMD_ENABLE_X86
+      if (i >= SIMD_SSE2) {
+        /* No SSE4.1 instruction helps these kernels */
+        k.copy = CopySSE2;
+        k.zero = ZeroSSE2;
+        k.dgap = DgapSSE2;
+      }
+
+      if (i >= SIMD_SSE41 && features.sse42)
+        k.crc32c = Crc32cSSE42;
+
+      if (i >= SIMD_AVX2) {
+        k.copy = CopyAVX2;
+        k.zero = ZeroAVX2;
+        k.dgap = DgapAVX2;
+      }
+
+      if (i >= SIMD_AVX512) {
+        k.copy = CopyAVX512;
+        k.zero = ZeroAVX512;
+        k.dgap = DgapAVX512;
+      }
+#endif /* SIMD_ENABLE_X86 */
+    }
+  }
+};
+
+const SimdState& GetSimdState() {
+  static const SimdState state;
+  return state;
+}
+
+/* Constant-initialized, so it is valid before simdKernels is bound */
+const SimdKernels scalarKernels = {
+  SIMD_SCALAR, CopyScalar, ZeroScalar, DgapScalar, Crc32cScalar
+};
+
+} /* namespace: */
+
+const SimdKernels *simdKernels = &scalarKernels;
+
+namespace {
+
+const bool simdKernelsBound = (simdKernels = &GetSimdKernels(), true);
+
+} /* namespace: */
+
+const CpuFeatures& GetCpuFeatures() {
+  return GetSimdState().features;
+}
+
+int GetSimdLevel() {
+  return GetSimdState().level;
+}
+
+const char *GetSimdLevelName(int level) {
+  if (level < SIMD_SCALAR || level > SIMD_AVX512)
+    return "unknown";
+  return SIMD_LEVEL_NAMES[level];
+}
+
+const SimdKernels& GetSimdKernels() {
+  const SimdState& s = GetSimdState();
+  return s.kernels[s.level];
+}
+
+const SimdKernels& GetSimdKernels(int level) {
+  const SimdState& s = GetSimdState();
+  if (level > s.detected)
+    level = s.detected;
+  if (level < SIMD_SCALAR)
+    level = SIMD_SCALAR;
+  return s.kernels[level];
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
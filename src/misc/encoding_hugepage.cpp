@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_hugepage.cpp - Buffers and mappings on huge pages
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_internals.hpp>
+#include <misc/encoding_hugepage.hpp>
+
+#include <atomic>
+#include <new>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+/* Buffers in any thread check it, so it is loaded once and atomic */
+std::atomic<bool>& defaultEnabled() {
+  static std::atomic<bool> enabled([] {
+    const char *env = getenv(HUGEPAGE_ENV);
+    return env != NULL && strcmp(env, "1") == 0;
+  }());
+
+  return enabled;
+}
+
+uint64_t HugePageRoundUp(uint64_t n) {
+  return (n + HUGEPAGE_SZ - 1) & ~(HUGEPAGE_SZ - 1);
+}
+
+/* Map [n] bytes aligned to huge pages, or return NULL */
+void *MapHugePages(uint64_t n) {
+#ifdef MAP_HUGETLB
+  /* Reserved pages are taken first, and it fails without them */
+  void *pages = mmap(NULL, n, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (pages != MAP_FAILED)
+    return pages;
+#endif
+
+  /* Over-map by a huge page, and trim both ends to align it */
+  char *base = reinterpret_cast<char *>(
+      mmap(NULL, n + HUGEPAGE_SZ, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  if (base == MAP_FAILED)
+    return NULL;
+
+  uintptr_t head = reinterpret_cast<uintptr_t>(base);
+  char *addr = reinterpret_cast<char *>(HugePageRoundUp(head));
+
+  if (addr != base)
+    munmap(base, addr - base);
+  munmap(addr + n, base + n + HUGEPAGE_SZ - addr - n);
+
+  AdviseHugePages(addr, n);
+  return addr;
+}
+
+} /* namespace: */
+
+bool IsHugePageEnabled() {
+  return defaultEnabled().load(std::memory_order_relaxed);
+}
+
+void SetHugePageEnabled(bool enabled) {
+  defaultEnabled().store(enabled, std::memory_order_relaxed);
+}
+
+void *AllocBuffer(uint64_t n, bool *huge) {
+  *huge = false;
+
+  if (IsHugePageEnabled() && n >= HUGEPAGE_SZ) {
+    void *addr = MapHugePages(HugePageRoundUp(n));
+    if (addr != NULL) {
+      *huge = true;
+      return addr;
+    }
+  }
+
+  return ::operator new[](n);
+}
+
+void FreeBuffer(void *addr, uint64_t n, bool huge) {
+  if (addr == NULL)
+    return;
+
+  if (huge)
+    munmap(addr, HugePageRoundUp(n));
+  else
+    ::operator delete[](addr);
+}
+
+void AdviseHugePages(void *addr, uint64_t n) {
+#ifdef MADV_HUGEPAGE
+  if (IsHugePageEnabled() && addr != NULL && n != 0)
+    madvise(addr, n, MADV_HUGEPAGE);
+#endif
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
@@ -0,0 +1,85 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_prefetch.cpp - Software prefetching of lists and blocks
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_internals.hpp>
+#include <misc/encoding_prefetch.hpp>
+
+#include <unistd.h>
+
+namespace integer_encoding {
+namespace internals {
+
+bool ParsePrefetchConfig(const char *str, PrefetchConfig *conf) {
+  if (str == NULL || conf == NULL)
+    return false;
+
+  char *p;
+  unsigned long lists = strtoul(str, &p, 10);
+  if (p == str || *p != ':')
+    return false;
+
+  const char *q = p + 1;
+  unsigned long blocks = strtoul(q, &p, 10);
+  if (p == q || *p != '\0' || lists > UINT32_MAX || blocks > UINT32_MAX)
+    return false;
+
+  conf->lists = static_cast<uint32_t>(lists);
+  conf->blocks = static_cast<uint32_t>(blocks);
+  return true;
+}
+
+namespace {
+
+PrefetchConfig& defaultConfig() {
+  /*
+   * Decoders in several threads read it, so it is loaded once by
+   * the initialization of a static, which costs a check afterwards.
+   */
+  static PrefetchConfig conf = [] {
+    PrefetchConfig c;
+    ParsePrefetchConfig(getenv(PREFETCH_ENV), &c);
+    return c;
+  }();
+
+  return conf;
+}
+
+} /* namespace: */
+
+const PrefetchConfig& GetPrefetchConfig() {
+  return defaultConfig();
+}
+
+void SetPrefetchConfig(const PrefetchConfig& conf) {
+  defaultConfig() = conf;
+}
+
+void AdviseWillNeed(const void *addr, uint64_t n) {
+  static const uintptr_t pgsz = sysconf(_SC_PAGESIZE);
+
+  if (addr == NULL || n == 0)
+    return;
+
+  /* madvise() takes page-aligned addresses */
+  uintptr_t head = reinterpret_cast<uintptr_t>(addr) & ~(pgsz - 1);
+  uintptr_t tail = reinterpret_cast<uintptr_t>(addr) + n;
+
+  /* It is only a hint, so errors are ignored */
+  madvise(reinterpret_cast<void *>(head), tail - head, MADV_WILLNEED);
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
@@ -0,0 +1,187 @@
+/*-----------------------------------------------------------------------------
+ *  encoding_stats.cpp - Statistics collected inside codecs
+ *
+ *  Coding-Style: google-styleguide
+ *      https://code.google.com/p/google-styleguide/
+ *
+ *  Authors:
+ *      Takeshi Yamamuro <linguin.m.s_at_gmail.com>
+ *      Fabrizio Silvestri <fabrizio.silvestri_at_isti.cnr.it>
+ *      Rossano Venturini <rossano.venturini_at_isti.cnr.it>
+ *
+ *  Copyright 2012 Integer Encoding Library <integerencoding_at_isti.cnr.it>
+ *      http://integerencoding.ist.cnr.it/
+ *-----------------------------------------------------------------------------
+ */
+
+#include <misc/encoding_internals.hpp>
+#include <misc/encoding_stats.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace integer_encoding {
+namespace internals {
+
+namespace {
+
+const char *STAT_NAMES[] = {
+  "afor_framelen", "kafor_framelen", "vsedp_loops",
+  "vseop_loops", "vse_parts", "vsenaive_blocklen"
+};
+
+/*
+ * Counters of a thread. Only the owner writes them, and
+ * relaxed atomics let other threads read them without
+ * a lock on the hot path.
+ */
+struct StatBlock {
+  std::atomic<uint64_t> count[STAT_NUMS];
+  std::atomic<uint64_t> sum[STAT_NUMS];
+  std::atomic<uint64_t> max[STAT_NUMS];
+  std::atomic<uint64_t> hist[STAT_NUMS][STAT_NBUCKETS];
+  StatBlock *next;
+
+  StatBlock();
+  ~StatBlock();
+
+  void reset() {
+    for (uint32_t i = 0; i < STAT_NUMS; i++) {
+      count[i].store(0, std::memory_order_relaxed);
+      sum[i].store(0, std::memory_order_relaxed);
+      max[i].store(0, std::memory_order_relaxed);
+      for (uint32_t j = 0; j < STAT_NBUCKETS; j++)
+        hist[i][j].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  void add(uint32_t id, EncodingStat *st) const {
+    st->count += count[id].load(std::memory_order_relaxed);
+    st->sum += sum[id].load(std::memory_order_relaxed);
+    uint64_t m = max[id].load(std::memory_order_relaxed);
+    if (st->max < m)
+      st->max = m;
+    for (uint32_t j = 0; j < STAT_NBUCKETS; j++)
+      st->hist[j] += hist[id][j].load(std::memory_order_relaxed);
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(StatBlock);
+};
+
+/* Threads register their blocks once, and exited ones are kept */
+struct StatRegistry {
+  std::mutex    lock;
+  StatBlock     *head;
+  EncodingStat  retired[STAT_NUMS];
+
+  StatRegistry() : lock(), head(NULL) {
+    memset(retired, 0x00, sizeof(retired));
+  }
+};
+
+StatRegistry& Registry() {
+  static StatRegistry *r = new StatRegistry();
+  return *r;
+}
+
+StatBlock::StatBlock() : next(NULL) {
+  reset();
+
+  StatRegistry& r = Registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  next = r.head;
+  r.head = this;
+}
+
+StatBlock::~StatBlock() {
+  StatRegistry& r = Registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  for (uint32_t i = 0; i < STAT_NUMS; i++)
+    add(i, &r.retired[i]);
+
+  StatBlock **p = &r.head;
+  while (*p != this)
+    p = &(*p)->next;
+  *p = next;
+}
+
+/* Values in [2^(b-1), 2^b) fall in a bucket b */
+inline uint32_t Bucket(uint64_t v) {
+  return (v != 0)? 64 - __builtin_clzll(v) : 0;
+}
+
+inline void Increment(std::atomic<uint64_t> *c, uint64_t v) {
+  c->store(c->load(std::memory_order_relaxed) + v,
+           std::memory_order_relaxed);
+}
+
+} /* namespace: */
+
+void RecordEncodingStat(uint32_t id, uint64_t v) {
+  ASSERT(id < STAT_NUMS);
+
+  static thread_local StatBlock block;
+  Increment(&block.count[id], 1);
+  Increment(&block.sum[id], v);
+  Increment(&block.hist[id][Bucket(v)], 1);
+  if (block.max[id].load(std::memory_order_relaxed) < v)
+    block.max[id].store(v, std::memory_order_relaxed);
+}
+
+void GetEncodingStat(uint32_t id, EncodingStat *st) {
+  if (id >= STAT_NUMS)
+    THROW_ENCODING_EXCEPTION("Out of range exception: id");
+  if (st == NULL)
+    THROW_ENCODING_EXCEPTION("Invalid input: st");
+
+  StatRegistry& r = Registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  *st = r.retired[id];
+  for (StatBlock *b = r.head; b != NULL; b = b->next)
+    b->add(id, st);
+}
+
+void ResetEncodingStats() {
+  StatRegistry& r = Registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  memset(r.retired, 0x00, sizeof(r.retired));
+  for (StatBlock *b = r.head; b != NULL; b = b->next)
+    b->reset();
+}
+
+void DumpEncodingStats(FILE *fp) {
+  if (!ENCODING_STATS_ENABLED) {
+    fprintf(fp, "Statistics disabled: build with -DINTEGER_ENCODING_STATS\n");
+    return;
+  }
+
+  for (uint32_t i = 0; i < STAT_NUMS; i++) {
+    EncodingStat st;
+    GetEncodingStat(i, &st);
+    if (st.count == 0)
+      continue;
+
+    fprintf(fp, "%s: count=%llu sum=%llu max=%llu avg=%.2f\n",
+            STAT_NAMES[i], static_cast<unsigned long long>(st.count),
+            static_cast<unsigned long long>(st.sum),
+            static_cast<unsigned long long>(st.max),
+            static_cast<double>(st.sum) / st.count);
+
+    for (uint32_t b = 0; b < STAT_NBUCKETS; b++) {
+      if (st.hist[b] == 0)
+        continue;
+      fprintf(fp, "  < 2^%-2u: %llu\n", b,
+              static_cast<unsigned long long>(st.hist[b]));
+    }
+  }
+}
+
+const char *GetEncodingStatName(uint32_t id) {
+  if (id >= STAT_NUMS)
+    THROW_ENCODING_EXCEPTION("Out of range exception: id");
+  return STAT_NAMES[id];
+}
+
+} /* namespace: internals */
+} /* namespace: integer_encoding */
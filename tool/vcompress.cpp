@@ -33,18 +33,34 @@ namespace {
 /* Current version embeded in a file header */
 const uint32_t VC_MAGIC = 0x0f823cb4;
 const uint32_t VC_MAJOR = 0;
-const uint32_t VC_MINOR = 3;
+const uint32_t VC_MINOR = 4;
 const uint32_t VC_PATCHLEVEL = 0;
 const uint32_t VC_VERSION = ((VC_MAJOR << 16) | (VC_MINOR << 8) | VC_PATCHLEVEL);
 
+/*
+ * Files of 0.3.0 are still read except ones of VSEncodingSimple,
+ * which are encoded in chunks since 0.4.0.
+ */
+const uint32_t VC_VERSION_0_3 = ((0 << 16) | (3 << 8) | 0);
+
 /* Valid options */
 bool decompress_enabled = false;
 bool verbose_enabled = false;
 bool squeeze_enabled = false;
+bool stats_enabled = false;
+bool verify_enabled = false;
+bool tlb_enabled = false;
+bool append_enabled = false;
+bool merge_enabled = false;
+int format_version = 1;
+uint32_t list_alignment = LIST_CONTAINER_ALIGN_WORD;
+uint64_t batch_lists = 0;
 int encoder_id = -1;
 uint64_t num_compressed = 0;
 std::string input;
 std::string output;
+std::string append_input;
+std::vector<std::string> merge_inputs;
 
 /* Extensions for encoders */
 const std::string encoder_suffix[] = { ".gamma", /* N Gamma */
@@ -66,20 +82,52 @@ const std::string encoder_suffix[] = { ".gamma", /* N Gamma */
 ".vseh", /* VSEncodingBlocksHybrid */
 ".vses", /* VSEncodingSimple */
 ".kafor", /* KAFOR */
-".afor" /* AFOR */
+".afor", /* AFOR */
+".adp" /* AdaptiveBlocks */
 };
 
 /* For position of data */
 const std::string pos_suffix = ".vc";
 
+/* For a single file of the v2 format */
+const std::string container_suffix = ".vc2";
+
 void show_usage() {
 	fprintf(stderr, "Usage: vcompress [OPTIONS]... [ID] [FILE] [OUT]\n");
+	fprintf(stderr, "   or: vcompress -u [OPTIONS]... [INDEX] [FILE] [OUT]\n");
+	fprintf(stderr, "   or: vcompress -m [OPTIONS]... [OUT] [SEGMENT]...\n");
 	fprintf(stderr, "Compress or uncompress FILE ");
 	fprintf(stderr, "(by default, compress FILE).\n");
+	fprintf(stderr, "-a XXX, alignment of lists in v2 files: ");
+	fprintf(stderr, "4 (default), 16, 64 or 4096 bytes\n");
+	fprintf(stderr, "-b XXX, read v2 files by batches of XXX lists ");
+	fprintf(stderr, "with io_uring or threads of pread\n");
+	fprintf(stderr, "-c, check CRC-32C of lists before decoding v2 files\n");
 	fprintf(stderr, "-d, decompress\n");
+	fprintf(stderr, "-f XXX, file format to compress: 1 (default) or 2\n");
+	fprintf(stderr, "-H, put input files and buffers on huge pages\n");
 	fprintf(stderr, "-l, compressor ID list\n");
+	fprintf(stderr, "-m, merge v2 SEGMENTs, whose k-th lists are ");
+	fprintf(stderr, "of the same term, into OUT\n");
 	fprintf(stderr, "-n XXX, number to decompress\n");
+	fprintf(stderr, "-P XXX, prefetch distances in lists and blocks ");
+	fprintf(stderr, "as <lists>:<blocks>, where 0 turns each off\n");
+	fprintf(stderr, "-p XXX, partition policy of VSEncoding codecs: ");
+	fprintf(stderr, "exact, greedy, approx or approx:<eps1>:<eps2>\n");
+	fprintf(stderr, "-s, show statistics of codecs\n");
+	fprintf(stderr, "-T, show dTLB misses in decoding, ");
+	fprintf(stderr, "e.g., to compare runs with and without -H\n");
+	fprintf(stderr, "-u, append the k-th list of FILE to the k-th list ");
+	fprintf(stderr, "of a v2 INDEX, and write OUT\n");
 	fprintf(stderr, "-v, verbose mode\n\n");
+	fprintf(stderr, "Set INTEGER_ENCODING_SIMD to scalar, sse2, sse4.1, ");
+	fprintf(stderr, "avx2 or avx512 to limit SIMD kernels.\n");
+	fprintf(stderr, "Set INTEGER_ENCODING_VSE_LAMBDA to bits per ns ");
+	fprintf(stderr, "to trade space for decode speed in VSEncoding.\n");
+	fprintf(stderr, "Set INTEGER_ENCODING_AIO to pread to read batches ");
+	fprintf(stderr, "without io_uring.\n");
+	fprintf(stderr, "Set INTEGER_ENCODING_PREFETCH as -P does.\n");
+	fprintf(stderr, "Set INTEGER_ENCODING_HUGEPAGE to 1 as -H does.\n\n");
 	fprintf(stderr, "Report bugs to <integerencoding_at_isti.cnr.it>\n\n");
 
 	exit(1);
@@ -109,6 +157,7 @@ void show_ids() {
 	fprintf(stderr, "17\tVSEncodingSimple\n");
 	fprintf(stderr, "18\tKAFOR\n");
 	fprintf(stderr, "19\tAFOR\n");
+	fprintf(stderr, "20\tAdaptiveBlocks\n");
 	fprintf(stderr, "\n");
 
 	exit(1);
@@ -119,21 +168,80 @@ int parse_command(int argc, char **argv) {
 	char *end;
 
 	/* Read input options 获取运行参数 */
-	while ((result = getopt(argc, argv, "dlvhn:")) != -1) {
+	while ((result = getopt(argc, argv, "cdlmsuvhHTa:b:f:n:p:P:")) != -1) {
 		switch (result) {
+		case 'a': {
+			list_alignment = strtol(optarg, &end, 10);
+			if (*end != '\0' || (list_alignment != LIST_CONTAINER_ALIGN_WORD &&
+					list_alignment != LIST_CONTAINER_ALIGN_SIMD &&
+					list_alignment != LIST_CONTAINER_ALIGN_LINE &&
+					list_alignment != LIST_CONTAINER_ALIGN_PAGE))
+				show_usage();
+			break;
+		}
+		case 'b': {
+			batch_lists = strtoull(optarg, &end, 10);
+			if (*end != '\0' || batch_lists == 0)
+				show_usage();
+			break;
+		}
+		case 'c': {
+			verify_enabled = true;
+			break;
+		}
 		case 'd': {
 			decompress_enabled = true;
 			break;
 		}
+		case 'H': {
+			SetHugePageEnabled(true);
+			break;
+		}
+		case 'f': {
+			format_version = strtol(optarg, &end, 10);
+			if (*end != '\0' || (format_version != 1 && format_version != 2))
+				show_usage();
+			break;
+		}
 		case 'v': {
 			verbose_enabled = true;
 			break;
 		}
+		case 's': {
+			stats_enabled = true;
+			break;
+		}
+		case 'T': {
+			tlb_enabled = true;
+			break;
+		}
+		case 'u': {
+			append_enabled = true;
+			break;
+		}
+		case 'm': {
+			merge_enabled = true;
+			break;
+		}
 		case 'n': {
 			squeeze_enabled = true;
 			num_compressed = strtol(optarg, &end, 10);
 			break;
 		}
+		case 'p': {
+			VSEPartitionConfig conf;
+			if (!ParseVSEPartitionConfig(optarg, &conf))
+				show_usage();
+			SetVSEPartitionConfig(conf);
+			break;
+		}
+		case 'P': {
+			PrefetchConfig conf;
+			if (!ParsePrefetchConfig(optarg, &conf))
+				show_usage();
+			SetPrefetchConfig(conf);
+			break;
+		}
 		case 'l': {
 			show_ids();
 			break;
@@ -153,6 +261,34 @@ int parse_command(int argc, char **argv) {
 			&& (num_compressed <= NSKIP || num_compressed >= MAXLEN))
 		return 1;
 
+	/* Only v2 files record where lists start */
+	if (list_alignment != LIST_CONTAINER_ALIGN_WORD && format_version != 2)
+		return 1;
+
+	if (merge_enabled) {
+		/* Left arguments MUST be >= 2: output and segments */
+		if (decompress_enabled || append_enabled || argc < optind + 2)
+			return 1;
+
+		output = argv[optind++];
+		while (optind < argc)
+			merge_inputs.push_back(argv[optind++]);
+
+		return 0;
+	}
+
+	if (append_enabled) {
+		/* Left arguments MUST be 3: an index, lists to append and output */
+		if (decompress_enabled || argc < optind + 3)
+			return 1;
+
+		input = argv[optind++];
+		append_input = argv[optind++];
+		output = argv[optind];
+
+		return 0;
+	}
+
 	if (decompress_enabled) {
 		/* Left arguments MUST be >= 1 */
 		/* getopt函数会将选项及其参数放在argv最左边
@@ -252,6 +388,20 @@ void write_pos_entry(uint64_t pos, FILE *out) {
 	fwrite(buf, 8, 1, out);
 }
 
+/* v2 files are told from v1 ones by the magic in their heads */
+bool is_container_file(const std::string& input) {
+	uint32_t buf[2];
+	FILE *fp = fopen(input.c_str(), "r");
+	if (fp == NULL)
+		OUTPUT_AND_DIE("Exception: can't open the file.");
+
+	uint64_t n = fread(buf, 1, sizeof(buf), fp);
+	fclose(fp);
+
+	return n == sizeof(buf) && ListContainerReader::Probe(buf,
+			LIST_CONTAINER_HEADER_SZ + LIST_CONTAINER_FOOTER_SZ);
+}
+
 void validate_encoder_id(uint32_t **pos) {
 	encoder_id = VC_LOAD32(*pos);
 	if ((encoder_id < 0) || (encoder_id >= NUMCODERS))
@@ -264,7 +414,8 @@ void validate_headerinfo(uint32_t **cmp, uint64_t cmplen, uint32_t **pos,
 	uint32_t version = VC_LOAD32(*pos);
 	uint32_t magic = VC_LOAD32(*pos);
 
-	if (magic != VC_MAGIC || version != VC_VERSION)
+	if (magic != VC_MAGIC || (version != VC_VERSION &&
+			(version != VC_VERSION_0_3 || encoder_id == E_VSESIMPLE)))
 		OUTPUT_AND_DIE("File format exception: version");
 
 	/* Check a correct pair of compressed data */
@@ -595,11 +746,24 @@ void do_compress(const std::string& input, int id) {
 	uint64_t len = 0;
 	uint32_t *addr = OpenFile(input, &len);
 
-	/* Open output files */
-	FILE *cmp = fopen((input + encoder_suffix[id]).c_str(), "w");
-	FILE *pos = fopen((input + pos_suffix).c_str(), "w");
-	if (cmp == NULL || pos == NULL)
-		OUTPUT_AND_DIE("Exception: can't open output files");
+	/* Open output files, or a single file for the v2 format */
+	FILE *cmp = NULL;
+	FILE *pos = NULL;
+	std::unique_ptr<ListContainerWriter> container;
+
+	if (format_version == 2) {
+		try {
+			container.reset(new ListContainerWriter(input + container_suffix,
+					list_alignment));
+		} catch (const encoding_exception&) {
+			OUTPUT_AND_DIE("Exception: can't open output files");
+		}
+	} else {
+		cmp = fopen((input + encoder_suffix[id]).c_str(), "w");
+		pos = fopen((input + pos_suffix).c_str(), "w");
+		if (cmp == NULL || pos == NULL)
+			OUTPUT_AND_DIE("Exception: can't open output files");
+	}
 
 	/* Allocate the pre-defined size of memory */
 	REGISTER_VECTOR_RAII(uint32_t, list, MAXLEN);
@@ -608,7 +772,8 @@ void do_compress(const std::string& input, int id) {
 	EncodingPtr c = EncodingFactory::create(id);
 
 	/* Skip a header, and fill it finally  */
-	skip_headerinfo(cmp, pos);
+	if (container == NULL)
+		skip_headerinfo(cmp, pos);
 
 	/* Do actual compression */
 	uint64_t cmp_pos = 0;
@@ -658,7 +823,8 @@ void do_compress(const std::string& input, int id) {
 				num = num_compressed;
 			}
 
-			write_pos_entry(num, base, cmp_pos, pos);
+			if (container == NULL)
+				write_pos_entry(num, base, cmp_pos, pos);
 
 			uint64_t cmp_size = MAXLEN;
 
@@ -667,7 +833,10 @@ void do_compress(const std::string& input, int id) {
 			elapsed += t.elapsed();
 
 			/* NOTE: the data in cmp_array are byte-order free */
-			fwrite(cmp_array, 4, cmp_size, cmp);
+			if (container != NULL)
+				container->append(id, num - 1, base, cmp_array, cmp_size);
+			else
+				fwrite(cmp_array, 4, cmp_size, cmp);
 			cmp_pos += cmp_size;
 		} else {
 			/* Skip a needless list */
@@ -676,13 +845,21 @@ void do_compress(const std::string& input, int id) {
 	}
 
 	LOOP_END:
-	/* Write the terminal position for decoding */
-	write_pos_entry(cmp_pos, pos);
-	/* Fill the header */
-	write_headerinfo(cmp, pos);
-
-	fclose(cmp);
-	fclose(pos);
+	if (container != NULL) {
+		try {
+			container->close();
+		} catch (const encoding_exception&) {
+			OUTPUT_AND_DIE("Exception: can't write output files");
+		}
+	} else {
+		/* Write the terminal position for decoding */
+		write_pos_entry(cmp_pos, pos);
+		/* Fill the header */
+		write_headerinfo(cmp, pos);
+
+		fclose(cmp);
+		fclose(pos);
+	}
 
 	/* Show performance results */
 	fprintf(stdout, "Performance Results(ID:%d):\n", encoder_id);
@@ -696,6 +873,394 @@ void do_compress(const std::string& input, int id) {
 	fprintf(stdout, "  Size: %.2lfbpi\n", ((cmp_pos + 0.0) / total) * 32);
 }
 
+/* Show huge pages and dTLB misses in decoding if -T is given */
+void show_tlb_results(const TlbCounter& tlb, uint64_t dnum) {
+	fprintf(stdout, "  Huge Pages: %s\n",
+			(IsHugePageEnabled())? "enabled" : "disabled");
+	if (!tlb_enabled)
+		return;
+
+	int64_t misses = tlb.misses();
+	int64_t loads = tlb.loads();
+	if (misses < 0) {
+		fprintf(stdout, "  dTLB Misses: unavailable\n");
+		return;
+	}
+
+	fprintf(stdout, "  dTLB Misses: %lld (%.3lf per 1K ints)\n",
+			static_cast<long long>(misses), misses * 1000.0 / dnum);
+	if (loads > 0)
+		fprintf(stdout, "  dTLB Miss Rate: %.4lf%%\n",
+				misses * 100.0 / loads);
+}
+
+/*
+ * Read lists by batches instead of mmap, so that a batch does not
+ * stall on page faults one by one if a file is not cached.
+ */
+void do_fetch_container(const std::string& input,
+		const std::string& output) {
+	std::unique_ptr<ListFetcher> f;
+	try {
+		f.reset(new ListFetcher(input));
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("File format exception: container");
+	}
+
+	/* Open a output file */
+	FILE *out = NULL;
+	if (output.length() != 0) {
+		out = fopen(output.c_str(), "w");
+		if (out == NULL)
+			OUTPUT_AND_DIE("Exception: can't open a output file");
+	}
+
+	/* Lists come in any order, so a batch is written after it ends */
+	std::vector<uint64_t> ids;
+	std::vector<std::vector<uint32_t> > lists;
+
+	/* Summary information */
+	uint64_t dnum = 0;
+	uint64_t cmp_len = 0;
+	double elapsed = 0;
+
+	for (uint64_t head = 0; head < f->size(); head += batch_lists) {
+		uint64_t n = std::min(batch_lists, f->size() - head);
+
+		ids.resize(n);
+		lists.resize(n);
+		for (uint64_t k = 0; k < n; k++) {
+			ids[k] = head + k;
+			ListEntry e = f->entry(ids[k]);
+			if (e.num >= MAXLEN)
+				OUTPUT_AND_DIE("File format exception: list length");
+
+			/* Benchmarks show the last codec, as v1 files have only one */
+			encoder_id = e.codec;
+			dnum += e.num;
+			cmp_len += e.len;
+		}
+
+		BenchmarkTimer t;
+		try {
+			f->fetch(ids.data(), n,
+					[&](uint64_t k, const ListEntry& e, const uint32_t *list) {
+				if (out == NULL)
+					return;
+
+				lists[k].assign(list, list + e.num);
+				if (e.codec != E_BINARYIPL)
+					GetSimdKernels().dgap(lists[k].data(), e.num, e.base);
+			}, verify_enabled);
+		} catch (const encoding_exception&) {
+			OUTPUT_AND_DIE("Exception: can't fetch lists");
+		}
+		elapsed += t.elapsed();
+
+		/* Write in the output file */
+		for (uint64_t k = 0; out != NULL && k < n; k++) {
+			ListEntry e = f->entry(ids[k]);
+
+			char buf[8];
+			BYTEORDER_FREE_STORE32(buf, e.num + 1);
+			BYTEORDER_FREE_STORE32(buf + 4, e.base);
+			fwrite(buf, 8, 1, out);
+			fwrite(lists[k].data(), e.num, 4, out);
+		}
+	}
+
+	if (out != NULL)
+		fclose(out);
+
+	/* Show performance results, which include reads */
+	fprintf(stdout, "Performance Results(ID:%d):\n", encoder_id);
+	fprintf(stdout, "  SIMD: %s\n",
+			GetSimdLevelName(GetSimdLevel()));
+	fprintf(stdout, "  Reads: %s\n", (f->async())? "io_uring" : "pread");
+	fprintf(stdout, "  Total Num Decoded: %llu\n",
+			static_cast<unsigned long long>(dnum));
+	fprintf(stdout, "  Elapsed: %.2lf\n", elapsed);
+	fprintf(stdout, "  Performance: %.2lfmis\n",
+			(dnum + 0.0) / (elapsed * 1000000));
+	fprintf(stdout, "  Throughput: %.2lfGiB/s\n",
+			dnum * 4.0 / (elapsed * 1024 * 1024 * 1024));
+	fprintf(stdout, "  Size: %.2lfbpi\n", ((cmp_len + 0.0) / dnum) * 32);
+}
+
+void do_decompress_container(const std::string& input,
+		const std::string& output) {
+	if (batch_lists != 0) {
+		do_fetch_container(input, output);
+		return;
+	}
+
+	std::unique_ptr<ListContainerReader> rd;
+	try {
+		rd.reset(new ListContainerReader(input));
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("File format exception: container");
+	}
+
+	/* Open a output file */
+	FILE *out = NULL;
+	if (output.length() != 0) {
+		out = fopen(output.c_str(), "w");
+		if (out == NULL)
+			OUTPUT_AND_DIE("Exception: can't open a output file");
+	}
+
+	/* Check all the lists at once, which is skipped by default */
+	double verify_elapsed = 0;
+	if (verify_enabled) {
+		BenchmarkTimer t;
+		if (rd->verifyAll() != 0)
+			OUTPUT_AND_DIE("File format exception: checksum");
+		verify_elapsed = t.elapsed();
+	}
+
+	REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(MAXLEN + 128));
+
+	/* Summary information */
+	uint64_t dnum = 0;
+	uint64_t cmp_len = 0;
+	double elapsed = 0;
+
+	const uint64_t dist = GetPrefetchConfig().lists;
+
+	/* Counted in the whole loop, so outputs should be off for it */
+	TlbCounter tlb;
+	if (tlb_enabled)
+		tlb.start();
+
+	for (uint64_t i = 0; i < rd->size(); i++) {
+		ListEntry e = rd->entry(i);
+		if (e.num >= MAXLEN)
+			OUTPUT_AND_DIE("File format exception: list length");
+
+		/* Pages of the next run of lists, and caches of the one ahead */
+		if (dist != 0) {
+			if (i % dist == 0)
+				rd->advise(i + dist, dist);
+			rd->prefetch(i + dist);
+		}
+
+		/* Benchmarks show the last codec, as v1 files have only one */
+		encoder_id = e.codec;
+
+		BenchmarkTimer t;
+		rd->decode(i, list);
+		elapsed += t.elapsed();
+		dnum += e.num;
+		cmp_len += e.len;
+
+		/* Write in the output file */
+		if (out != NULL) {
+			char buf[8];
+			BYTEORDER_FREE_STORE32(buf, e.num + 1);
+			BYTEORDER_FREE_STORE32(buf + 4, e.base);
+			fwrite(buf, 8, 1, out);
+
+			if (e.codec != E_BINARYIPL)
+				GetSimdKernels().dgap(list, e.num, e.base);
+			fwrite(list, e.num, 4, out);
+		}
+	}
+
+	tlb.stop();
+
+	if (out != NULL)
+		fclose(out);
+
+	/* Show performance results */
+	fprintf(stdout, "Performance Results(ID:%d):\n", encoder_id);
+	fprintf(stdout, "  SIMD: %s\n",
+			GetSimdLevelName(GetSimdLevel()));
+	fprintf(stdout, "  Prefetch: %u:%u\n", GetPrefetchConfig().lists,
+			GetPrefetchConfig().blocks);
+	fprintf(stdout, "  Total Num Decoded: %llu\n",
+			static_cast<unsigned long long>(dnum));
+	fprintf(stdout, "  Elapsed: %.2lf\n", elapsed);
+	fprintf(stdout, "  Performance: %.2lfmis\n",
+			(dnum + 0.0) / (elapsed * 1000000));
+	fprintf(stdout, "  Throughput: %.2lfGiB/s\n",
+			dnum * 4.0 / (elapsed * 1024 * 1024 * 1024));
+	fprintf(stdout, "  Size: %.2lfbpi\n", ((cmp_len + 0.0) / dnum) * 32);
+	show_tlb_results(tlb, dnum);
+	if (verify_enabled)
+		fprintf(stdout, "  Verify Throughput: %.2lfGiB/s\n",
+				cmp_len * 4.0 / (verify_elapsed * 1024 * 1024 * 1024));
+}
+
+/*
+ * Append lists of a raw file to a v2 file. The k-th list of the
+ * raw file goes to the k-th list, and ones beyond the index are
+ * added with the codec of the last list. Docids to append MUST be
+ * larger than the last one of each list.
+ */
+void do_append_container(const std::string& input,
+		const std::string& append_input, const std::string& output) {
+	if (!is_container_file(input))
+		OUTPUT_AND_DIE("File format exception: container");
+
+	std::unique_ptr<ListContainerAppender> ap;
+	try {
+		ap.reset(new ListContainerAppender(input, output));
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("Exception: can't open files");
+	}
+
+	const ListContainerReader& rd = ap->base();
+	if (rd.size() == 0)
+		OUTPUT_AND_DIE("Exception: no list to append to");
+
+	/* Open a input file */
+	uint64_t len = 0;
+	uint32_t *addr = OpenFile(append_input, &len);
+	uint32_t *term = addr + (len >> 2);
+
+	REGISTER_VECTOR_RAII(uint32_t, list, DECODE_REQUIRE_MEM(MAXLEN + 128));
+	std::vector<uint32_t> add;
+
+	/* Summary information */
+	uint64_t total = 0;
+	uint64_t nadded = 0;
+	double elapsed = 0;
+
+	for (uint64_t k = 0; addr < term; k++) {
+		uint32_t num = VC_LOAD32(addr);
+		if (UNLIKELY(addr + num > term))
+			break;
+		if (num == 0)
+			continue;
+
+		bool extend = (k < rd.size());
+		if (!extend && (num <= NSKIP || num >= MAXLEN)) {
+			addr += num;
+			continue;
+		}
+
+		/* Find the last docid, from which gaps are taken */
+		ListEntry e = rd.entry((extend)? k : rd.size() - 1);
+		int id = e.codec;
+		uint32_t prev = VC_LOAD32(addr);
+		uint32_t base = prev;
+
+		if (extend) {
+			if (e.num + num >= MAXLEN)
+				OUTPUT_AND_DIE("Exception: too long lists");
+
+			uint32_t last = e.base;
+			if (e.num != 0) {
+				rd.decode(k, list);
+				if (id != E_BINARYIPL)
+					GetSimdKernels().dgap(list, e.num, e.base);
+				last = list[e.num - 1];
+			}
+
+			/* The first docid is appended as well */
+			prev = last;
+			addr--;
+		}
+
+		add.clear();
+		for (uint32_t i = (extend)? 0 : 1; i < num; i++) {
+			uint32_t d = VC_LOAD32(addr);
+			if (UNLIKELY(d <= prev)) {
+				fprintf(stderr,
+						"List Order Exception: Lists MUST be increasing\n");
+				exit(1);
+			}
+
+			add.push_back((id != E_BINARYIPL)? d - prev - 1 : d);
+			prev = d;
+		}
+
+		BenchmarkTimer t;
+		try {
+			if (extend)
+				ap->append(k, add.data(), add.size());
+			else
+				ap->add(id, base, add.data(), add.size());
+		} catch (const encoding_exception&) {
+			OUTPUT_AND_DIE("Exception: can't append lists");
+		}
+		elapsed += t.elapsed();
+
+		total += num;
+		if (!extend)
+			nadded++;
+	}
+
+	uint64_t nupdated = 0;
+	BenchmarkTimer t;
+	try {
+		nupdated = ap->close();
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("Exception: can't write output files");
+	}
+	elapsed += t.elapsed();
+
+	/* Show performance results */
+	fprintf(stdout, "Performance Results:\n");
+	fprintf(stdout, "  Total Num Appended: %llu\n",
+			static_cast<unsigned long long>(total));
+	fprintf(stdout, "  Lists Updated: %llu\n",
+			static_cast<unsigned long long>(nupdated));
+	fprintf(stdout, "  Lists Added: %llu\n",
+			static_cast<unsigned long long>(nadded));
+	fprintf(stdout, "  Elapsed: %.2lf\n", elapsed);
+	fprintf(stdout, "  Performance: %.2lfmis\n",
+			(total + 0.0) / (elapsed * 1000000));
+}
+
+/*
+ * Merge segments of an index list by list, where lists in disjoint
+ * ranges of docids keep blocks of the first range as they are.
+ */
+void do_merge_container(const std::vector<std::string>& inputs,
+		const std::string& output) {
+	for (size_t s = 0; s < inputs.size(); s++) {
+		if (!is_container_file(inputs[s]))
+			OUTPUT_AND_DIE("File format exception: container");
+	}
+
+	ListMergeConfig conf;
+	conf.align = list_alignment;
+	conf.verify = verify_enabled;
+
+	std::unique_ptr<ListContainerMerger> mg;
+	try {
+		mg.reset(new ListContainerMerger(inputs, conf));
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("Exception: can't open files");
+	}
+
+	ListMergeStats stats;
+	BenchmarkTimer t;
+	try {
+		mg->merge(output, &stats);
+	} catch (const encoding_exception&) {
+		OUTPUT_AND_DIE("Exception: can't merge lists");
+	}
+	double elapsed = t.elapsed();
+
+	/* Show performance results */
+	fprintf(stdout, "Performance Results:\n");
+	fprintf(stdout, "  Segments: %llu\n",
+			static_cast<unsigned long long>(inputs.size()));
+	fprintf(stdout, "  Total Num Merged: %llu\n",
+			static_cast<unsigned long long>(stats.nums));
+	fprintf(stdout, "  Lists Copied: %llu\n",
+			static_cast<unsigned long long>(stats.copied));
+	fprintf(stdout, "  Lists Spliced: %llu\n",
+			static_cast<unsigned long long>(stats.spliced));
+	fprintf(stdout, "  Lists Merged: %llu\n",
+			static_cast<unsigned long long>(stats.merged));
+	fprintf(stdout, "  Elapsed: %.2lf\n", elapsed);
+	fprintf(stdout, "  Performance: %.2lfmis\n",
+			(stats.nums + 0.0) / (elapsed * 1000000));
+}
+
 void do_decompress(const std::string& input, const std::string& output) {
 	/* Open a file for position */
 	uint64_t poslen = 0;
@@ -732,6 +1297,13 @@ void do_decompress(const std::string& input, const std::string& output) {
 	/* Do actual decompression */
 	uint32_t numHeaders = (poslen - POS_HEADER_SZ) / POS_EACH_ENTRY_SZ;
 
+	const uint64_t dist = GetPrefetchConfig().lists;
+
+	/* Counted in the whole loop, so outputs should be off for it */
+	TlbCounter tlb;
+	if (tlb_enabled)
+		tlb.start();
+
 	uint64_t cmp_pos = VC_LOAD64(pos);
 	for (uint64_t i = 0; i < numHeaders; i++) {
 		uint32_t num = VC_LOAD32(pos);
@@ -740,6 +1312,25 @@ void do_decompress(const std::string& input, const std::string& output) {
 
 		ASSERT(num < MAXLEN);
 
+		/*
+		 * Pages of the next run of lists, and caches of the one ahead.
+		 * The list i + k ends at the position of (pos + 4 * k - 2).
+		 */
+		if (dist != 0 && i + dist < numHeaders) {
+			uint64_t head = BYTEORDER_FREE_LOAD64(pos + 4 * dist - 6);
+			uint64_t tail = BYTEORDER_FREE_LOAD64(pos + 4 * dist - 2);
+
+			if (i % dist == 0) {
+				uint64_t last = std::min(i + 2 * dist, uint64_t(numHeaders)) - 1;
+				uint64_t atail = BYTEORDER_FREE_LOAD64(pos + 4 * (last - i) - 2);
+				if (head < atail && atail < (cmplen >> 2))
+					AdviseWillNeed(cmp + head, (atail - head) * 4);
+			}
+
+			if (head < tail && tail < (cmplen >> 2))
+				PrefetchBytes(cmp + head, (tail - head) * 4);
+		}
+
 		/* Do decoding */
 		uint32_t *ptr = reinterpret_cast<uint32_t *>(cmp) + cmp_pos;
 
@@ -757,13 +1348,9 @@ void do_decompress(const std::string& input, const std::string& output) {
 			fwrite(buf, 8, 1, out);
 
 			if (encoder_id != E_BINARYIPL) {
-				//with d-gap
-				for (uint32_t j = 0; j < num - 1; j++) {
-					uint32_t d = VC_LOAD32(list);
-					prev += d + 1;
-					BYTEORDER_FREE_STORE32(buf, prev);
-					fwrite(buf, 4, 1, out);
-				}
+				//with d-gap, restored in place by the dispatched kernel
+				GetSimdKernels().dgap(list, num - 1, prev);
+				fwrite(list, num - 1, 4, out);
 			} else {
 				// without d-gap
 				fwrite(list, num - 1, 4, out);
@@ -774,8 +1361,14 @@ void do_decompress(const std::string& input, const std::string& output) {
 		cmp_pos = next_pos;
 	}
 
+	tlb.stop();
+
 	/* Show performance results */
 	fprintf(stdout, "Performance Results(ID:%d):\n", encoder_id);
+	fprintf(stdout, "  SIMD: %s\n",
+			GetSimdLevelName(GetSimdLevel()));
+	fprintf(stdout, "  Prefetch: %u:%u\n", GetPrefetchConfig().lists,
+			GetPrefetchConfig().blocks);
 	fprintf(stdout, "  Total Num Decoded: %llu\n",
 			static_cast<unsigned long long>(dnum));
 	fprintf(stdout, "  Elapsed: %.2lf\n", elapsed);
@@ -784,6 +1377,7 @@ void do_decompress(const std::string& input, const std::string& output) {
 	fprintf(stdout, "  Throughput: %.2lfGiB/s\n",
 			dnum * 4.0 / (elapsed * 1024 * 1024 * 1024));
 	fprintf(stdout, "  Size: %.2lfbpi\n", ((cmp_pos + 0.0) / dnum) * 32);
+	show_tlb_results(tlb, dnum);
 }
 
 void CodecTest() {
@@ -852,11 +1446,20 @@ int main(int argc, char **argv) {
 		exit(1);
 	}
 	for (int i = 0; i < 1; ++i) {
-		if (decompress_enabled)
+		if (merge_enabled)
+			do_merge_container(merge_inputs, output);
+		else if (append_enabled)
+			do_append_container(input, append_input, output);
+		else if (decompress_enabled && is_container_file(input))
+			do_decompress_container(input, output);
+		else if (decompress_enabled)
 			do_decompress(input, output);
 		else
 			do_compress(input, encoder_id);
 	}
 
+	if (stats_enabled)
+		DumpEncodingStats(stderr);
+
 	return 0;
 }